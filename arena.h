@@ -0,0 +1,135 @@
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <exception>
+#include <atomic>
+
+class Arena
+{
+public:
+	// chunk: The size of a new chunk is doubled until "c_max_chunk_size_".
+	static const int64_t c_first_chunk_size_ = 1024;
+	static const int64_t c_max_chunk_size_ = 64 * 1024;
+	static const int64_t c_alignment_ = 8;
+	// head of a chunk: the previous chunk and the size of this chunk
+	static const int64_t c_head_size_ = 16;
+	// statistics of all arenas (for test)
+	static std::atomic<int64_t> s_allocation_number_;
+	static std::atomic<int64_t> s_byte_number_;
+	static std::atomic<int64_t> s_peak_byte_number_;
+	Arena();
+	~Arena();
+	void * Allocate(int64_t size);
+	char * CopyString(const char * string);
+	void Release();
+private:
+	Arena(const Arena &);
+	Arena & operator=(const Arena &);
+	static void s_AddByte(int64_t byte_number);
+	// current chunk: Its head keeps the previous chunk, so all chunks are a list.
+	char * chunk_;
+	int64_t chunk_size_;
+	int64_t used_;
+};
+
+std::atomic<int64_t> Arena::s_allocation_number_(0);
+std::atomic<int64_t> Arena::s_byte_number_(0);
+std::atomic<int64_t> Arena::s_peak_byte_number_(0);
+
+Arena::Arena()
+{
+	chunk_ = NULL;
+	chunk_size_ = 0;
+	used_ = 0;
+}
+
+Arena::~Arena()
+{
+	Release();
+}
+
+void * Arena::Allocate(int64_t size)
+{
+	// Allocate "size" bytes by moving a pointer, or return NULL if out of memory. They are freed only by function "Release".
+	if (size <= 0)
+	{
+		throw std::exception("Function \"void * Arena::Allocate(int64_t size)\" says: Invalid parameter \"size\".");
+	}
+	size = (size + c_alignment_ - 1) / c_alignment_ * c_alignment_;
+	if (NULL == chunk_ || used_ + size > chunk_size_)
+	{
+		// new chunk
+		int64_t chunk_size = 0 == chunk_size_ ? c_first_chunk_size_ : chunk_size_ * 2;
+		if (chunk_size > c_max_chunk_size_)
+		{
+			chunk_size = c_max_chunk_size_;
+		}
+		if (chunk_size < c_head_size_ + size)
+		{
+			chunk_size = c_head_size_ + size;
+		}
+		char * chunk = (char *)malloc(chunk_size);
+		if (NULL == chunk)
+		{
+			return NULL;
+		}
+		*(char **)chunk = chunk_;
+		*(int64_t *)(chunk + sizeof(char *)) = chunk_size;
+		chunk_ = chunk;
+		chunk_size_ = chunk_size;
+		used_ = c_head_size_;
+		s_AddByte(chunk_size);
+	}
+	void * pointer = chunk_ + used_;
+	used_ += size;
+	s_allocation_number_ += 1;
+	return pointer;
+}
+
+char * Arena::CopyString(const char * string)
+{
+	if (NULL == string)
+	{
+		throw std::exception("Function \"char * Arena::CopyString(const char * string)\" says: Invalid parameter \"string\".");
+	}
+	int64_t length = strlen(string);
+	char * copy = (char *)Allocate(length + 1);
+	if (NULL == copy)
+	{
+		return NULL;
+	}
+	memcpy(copy, string, length + 1);
+	return copy;
+}
+
+void Arena::Release()
+{
+	// Free all chunks at once. Objects in them are not destructed.
+	char * chunk;
+	int64_t byte_number = 0;
+	while (chunk_ != NULL)
+	{
+		chunk = *(char **)chunk_;
+		byte_number += *(int64_t *)(chunk_ + sizeof(char *));
+		free(chunk_);
+		chunk_ = chunk;
+	}
+	s_AddByte(-byte_number);
+	chunk_size_ = 0;
+	used_ = 0;
+}
+
+void Arena::s_AddByte(int64_t byte_number)
+{
+	int64_t byte_number_now = s_byte_number_ += byte_number;
+	int64_t peak = s_peak_byte_number_;
+	while (byte_number_now > peak && false == s_peak_byte_number_.compare_exchange_weak(peak, byte_number_now))
+		;
+}
+
+#endif
@@ -5,213 +5,98 @@
 
 #include <stdlib.h>
 #include <stdint.h>
-#include <math.h>
+#include <stdio.h>
+#include <string.h>
 #include <vector>
+#include <unordered_map>
 #include <exception>
 #include "variable_item.h"
-#include "word.h"
+#include "token_stream.h"
 #include "code_item.h"
+#include "arena.h"
 
 class FunctionItem;
 
 class Block
 {
 public:
-	static void s_FreeAll(Block * block);
+	// size of the buffer for functions "s_GetName" and "s_GetLabelName"
+	static const int64_t c_name_size_ = 64;
+	static char * s_GetName(int64_t block, char * buffer);
+	static char * s_GetLabelName(int64_t label, char * buffer);
 	Block();
-	~Block();
-	Block * AddChild();
-	void FreeAll();
-	int64_t SetName();
-	void GeneratLabelName(char * label_name);
-	// location
-	int64_t beginning_;
-	int64_t end_;
-	// pointer
+	int64_t GenerateLabel();
+	// function (only in a block of function)
 	FunctionItem * function_;
-	Block * parent_;
-	Block * child_;
-	Block * brother_;
-	// name
+	// id: It is the index in "BlockTree", where the location and the links of the block are. (Names of the block and its labels are made from it only when they are written.)
 	int64_t id_;
-	char * name_;
-	char * name_in_;
-	char * name_out_;
-	// information
+	// information: Variables are in the arena, and they are freed with the block.
+	Arena arena;
 	std::vector<VariableItem *> variable_table_;
-	Word word_header; // It is a linked list.
+	// scope: name -> id of the first variable defined in the block, and of the first parameter (only in a block of function) (see "symbol_table.h")
+	std::unordered_map<int32_t, int32_t> variable_scope_table_;
+	std::unordered_map<int32_t, int32_t> parameter_scope_table_;
+	TokenStream token_stream; // It is a struct of arrays.
 	int64_t label_id_now_;
-	std::vector<CodeItem *> intermediate;
-	std::vector<CodeItem *> assembler;
-private:
-	// id allocator
-	static int64_t s_GenerateId();
-	static int64_t s_id_;
+	std::vector<CodeItem> intermediate; // contiguous
+	std::vector<CodeItem> assembler;
 };
 
-void Block::s_FreeAll(Block * block)
-{
-	if (NULL == block)
-	{
-		throw std::exception("Function \"void Block::s_FreeAll(Block * block)\" says: Invalid parameter \"block\".");
-	}
-	block->FreeAll();
-	delete block;
-}
-
 Block::Block()
 {
-	beginning_ = -1;
-	end_ = -1;
 	function_ = NULL;
-	parent_ = NULL;
-	child_ = NULL;
-	brother_ = NULL;
-	id_ = s_GenerateId();
-	name_ = NULL;
-	name_in_ = NULL;
-	name_out_ = NULL;
+	id_ = -1;
 	label_id_now_ = -1;
 }
 
-Block::~Block()
+char * Block::s_GetName(int64_t block, char * buffer)
 {
-	if (name_ != NULL)
+	// "block_[id]"
+	if (block < 0)
 	{
-		delete[] name_;
-		name_ = NULL;
+		throw std::exception("Function \"char * Block::s_GetName(int64_t block, char * buffer)\" says: Invalid parameter \"block\".");
 	}
-	if (name_in_ != NULL)
+	if (NULL == buffer)
 	{
-		delete[] name_in_;
-		name_in_ = NULL;
-	}
-	if (name_out_ != NULL)
-	{
-		delete[] name_out_;
-		name_out_ = NULL;
-	}
-	for (int64_t i = 0; i < variable_table_.size(); ++i)
-	{
-		VariableItem::s_Free(variable_table_[i]);
-		variable_table_[i] = NULL;
-	}
-	for (int64_t i = 0; i < intermediate.size(); ++i)
-	{
-		CodeItem::s_Free(intermediate[i]);
-		intermediate[i] = NULL;
-	}
-	for (int64_t i = 0; i < assembler.size(); ++i)
-	{
-		CodeItem::s_Free(assembler[i]);
-		assembler[i] = NULL;
+		throw std::exception("Function \"char * Block::s_GetName(int64_t block, char * buffer)\" says: Invalid parameter \"buffer\".");
 	}
+	sprintf(buffer, "block_%I64d", block);
+	return buffer;
 }
 
-Block * Block::AddChild()
+char * Block::s_GetLabelName(int64_t label, char * buffer)
 {
-	Block * node;
-	Block * node_brother;
-	if (NULL == child_)
+	// "block_[id]_in", "block_[id]_out" or "block_[id]_label_[ordinal]"
+	if (NULL == buffer)
 	{
-		// add to child
-		child_ = new Block();
-		if (NULL == child_)
-		{
-			return NULL;
-		}
-		child_->parent_ = this;
-		return child_;
+		throw std::exception("Function \"char * Block::s_GetLabelName(int64_t label, char * buffer)\" says: Invalid parameter \"buffer\".");
 	}
-	else
-	{
-		// add to child's brother
-		node = child_;
-		node_brother = child_->brother_;
-		while (node_brother != NULL)
-		{
-			node = node_brother;
-			node_brother = node_brother->brother_;
-		}
-		node->brother_ = new Block();
-		if (NULL == node->brother_)
-		{
-			return NULL;
-		}
-		node->brother_->parent_ = this;
-	}
-	return node->brother_;
-}
-
-void Block::FreeAll()
-{
-	if (child_)
+	int64_t block = CodeItem::s_GetLabelBlock(label);
+	int64_t ordinal = CodeItem::s_GetLabelOrdinal(label);
+	int64_t length = 6;
+	memcpy(buffer, "block_", 6);
+	length += CodeItem::s_FormatInteger(block, buffer + length);
+	if (CodeItem::c_in_label_ == ordinal)
 	{
-		child_->FreeAll();
-		delete child_;
-		child_ = NULL;
+		memcpy(buffer + length, "_in", 4);
 	}
-	if (brother_)
+	else if (CodeItem::c_out_label_ == ordinal)
 	{
-		brother_->FreeAll();
-		delete brother_;
-		brother_ = NULL;
+		memcpy(buffer + length, "_out", 5);
 	}
-}
-
-int64_t Block::SetName()
-{
-	// name
-	if (name_ != NULL)
-	{
-		delete[] name_;
-		name_ = NULL;
-	}
-	name_ = new char[8 + int64_t(log10(double(id_)))];
-	if (NULL == name_)
-	{
-		return -1;
-	}
-	sprintf(name_, "block_%I64d", id_);
-	// name in
-	if (name_in_ != NULL)
-	{
-		delete[] name_in_;
-		name_in_ = NULL;
-	}
-	name_in_ = new char[11 + int64_t(log10(double(id_)))];
-	if (NULL == name_in_)
-	{
-		return -1;
-	}
-	sprintf(name_in_, "block_%I64d_in", id_);
-	// name out
-	if (name_out_ != NULL)
-	{
-		delete[] name_out_;
-		name_out_ = NULL;
-	}
-	name_out_ = new char[12 + int64_t(log10(double(id_)))];
-	if (NULL == name_out_)
+	else
 	{
-		return -1;
+		memcpy(buffer + length, "_label_", 7);
+		CodeItem::s_FormatInteger(ordinal, buffer + length + 7);
 	}
-	sprintf(name_out_, "block_%I64d_out", id_);
-	return 1;
+	return buffer;
 }
 
-void Block::GeneratLabelName(char * label_name)
+int64_t Block::GenerateLabel()
 {
+	// new label of the block (See function "s_GetLabelName".)
 	label_id_now_ += 1;
-	sprintf(label_name, "%s_label_%I64d", name_, label_id_now_);
+	return CodeItem::s_GetLabel(id_, label_id_now_);
 }
 
-int64_t Block::s_GenerateId()
-{
-	s_id_ += 1;
-	return s_id_;
-}
-
-int64_t Block::s_id_ = -2;
-
 #endif
@@ -0,0 +1,176 @@
+#ifndef BLOCK_TREE_H_
+#define BLOCK_TREE_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include "block.h"
+
+class BlockTree
+{
+public:
+	// no block (parent of a block of function, etc.)
+	static const int64_t c_none_ = -1;
+	BlockTree();
+	~BlockTree();
+	int64_t Append(int64_t parent);
+	void SetEnd(int64_t block, int64_t end);
+	void Resize(int64_t size);
+	void Clear();
+	int64_t SearchByBeginning(int64_t beginning);
+	int64_t SearchByEnd(int64_t end);
+	// number of blocks: A block is identified by its index, which is also its id.
+	int64_t size_;
+	// hot part: Blocks are appended in order of "{", so "beginning_table_" is sorted.
+	std::vector<int64_t> parent_table_;
+	std::vector<int64_t> root_table_; // block of the function
+	std::vector<int64_t> first_child_table_;
+	std::vector<int64_t> last_child_table_;
+	std::vector<int64_t> next_sibling_table_;
+	std::vector<int64_t> beginning_table_;
+	std::vector<int64_t> end_table_;
+	// blocks in order of "}" (sorted by end)
+	std::vector<int64_t> end_order_table_;
+	// cold part: names, variables, words and codes
+	std::vector<Block *> block_table_;
+};
+
+BlockTree::BlockTree()
+{
+	size_ = 0;
+}
+
+BlockTree::~BlockTree()
+{
+	Clear();
+}
+
+int64_t BlockTree::Append(int64_t parent)
+{
+	// Add a block as the last child of "parent", and return its index (or "c_none_" if out of memory).
+	if (parent < c_none_ || parent >= size_)
+	{
+		throw std::exception("Function \"int64_t BlockTree::Append(int64_t parent)\" says: Invalid parameter \"parent\".");
+	}
+	Block * block_p = new Block();
+	if (NULL == block_p)
+	{
+		return c_none_;
+	}
+	int64_t block = size_;
+	block_p->id_ = block;
+	block_table_.push_back(block_p);
+	parent_table_.push_back(parent);
+	root_table_.push_back(c_none_ == parent ? block : root_table_[parent]);
+	first_child_table_.push_back(c_none_);
+	last_child_table_.push_back(c_none_);
+	next_sibling_table_.push_back(c_none_);
+	beginning_table_.push_back(-1);
+	end_table_.push_back(-1);
+	size_ += 1;
+	// link: The last child is kept, so no sibling list is walked.
+	if (c_none_ != parent)
+	{
+		if (c_none_ == last_child_table_[parent])
+		{
+			first_child_table_[parent] = block;
+		}
+		else
+		{
+			next_sibling_table_[last_child_table_[parent]] = block;
+		}
+		last_child_table_[parent] = block;
+	}
+	return block;
+}
+
+void BlockTree::SetEnd(int64_t block, int64_t end)
+{
+	// Blocks must come to an end in order of "}".
+	if (block < 0 || block >= size_)
+	{
+		throw std::exception("Function \"void BlockTree::SetEnd(int64_t block, int64_t end)\" says: Invalid parameter \"block\".");
+	}
+	end_table_[block] = end;
+	end_order_table_.push_back(block);
+}
+
+void BlockTree::Resize(int64_t size)
+{
+	// Make room for "size" blocks at once in an empty tree, without links. The caller fills in the tables and the blocks ("block_table_" is full of NULL), as function "Preprocess" does in parallel.
+	if (size < 0 || size_ > 0)
+	{
+		throw std::exception("Function \"void BlockTree::Resize(int64_t size)\" says: Invalid parameter \"size\".");
+	}
+	block_table_.resize(size, NULL);
+	parent_table_.resize(size, c_none_);
+	root_table_.resize(size, c_none_);
+	first_child_table_.resize(size, c_none_);
+	last_child_table_.resize(size, c_none_);
+	next_sibling_table_.resize(size, c_none_);
+	beginning_table_.resize(size, -1);
+	end_table_.resize(size, -1);
+	end_order_table_.resize(size, c_none_);
+	size_ = size;
+}
+
+void BlockTree::Clear()
+{
+	for (int64_t i = 0; i < block_table_.size(); ++i)
+	{
+		delete block_table_[i];
+		block_table_[i] = NULL;
+	}
+	block_table_.clear();
+	parent_table_.clear();
+	root_table_.clear();
+	first_child_table_.clear();
+	last_child_table_.clear();
+	next_sibling_table_.clear();
+	beginning_table_.clear();
+	end_table_.clear();
+	end_order_table_.clear();
+	size_ = 0;
+}
+
+int64_t BlockTree::SearchByBeginning(int64_t beginning)
+{
+	// binary search, or return "c_none_"
+	std::vector<int64_t>::iterator it = std::lower_bound(beginning_table_.begin(), beginning_table_.end(), beginning);
+	if (it == beginning_table_.end() || *it != beginning)
+	{
+		return c_none_;
+	}
+	return it - beginning_table_.begin();
+}
+
+int64_t BlockTree::SearchByEnd(int64_t end)
+{
+	// binary search, or return "c_none_"
+	int64_t low = 0;
+	int64_t high = end_order_table_.size();
+	int64_t middle;
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (end_table_[end_order_table_[middle]] < end)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	if (low >= end_order_table_.size() || end_table_[end_order_table_[low]] != end)
+	{
+		return c_none_;
+	}
+	return end_order_table_[low];
+}
+
+#endif
@@ -8,144 +8,172 @@
 class CodeItem
 {
 public:
-	static CodeItem * s_Malloc();
-	static void s_Free(CodeItem * code_item);
+	// operation: "c_label_" is not an instruction but the definition of the label in the source operand.
+	static const int64_t c_label_ = 0;
+	static const int64_t c_mov_ = 1;
+	static const int64_t c_add_ = 2;
+	static const int64_t c_sub_ = 3;
+	static const int64_t c_mul_ = 4;
+	static const int64_t c_div_ = 5;
+	static const int64_t c_mod_ = 6;
+	static const int64_t c_cmp_ = 7;
+	static const int64_t c_jmp_ = 8;
+	static const int64_t c_je_ = 9;
+	static const int64_t c_jg_ = 10;
+	static const int64_t c_jl_ = 11;
+	static const int64_t c_call_ = 12;
+	static const int64_t c_parameter_ = 13;
+	static const int64_t c_ret_ = 14;
+	static const int64_t c_input_ = 15;
+	static const int64_t c_output_ = 16;
+	static const int64_t c_op_number_ = 17;
+	// kind of operand
+	static const int64_t c_none_ = 0;
+	static const int64_t c_register_ = 1; // "c_rc1_", etc.
+	static const int64_t c_variable_ = 2; // id in "SymbolTable"
+	static const int64_t c_immediate_ = 3; // value
+	static const int64_t c_label_id_ = 4; // see function "s_GetLabel"
+	static const int64_t c_function_ = 5; // id of the name in "Interner::s_interner_"
+	static const int64_t c_word_ = 6; // index of a word in the token stream of the block, written as it is (a constant out of 64-bit range, etc.)
+	// register
+	static const int64_t c_rc1_ = 0;
+	static const int64_t c_rc2_ = 1;
+	static const int64_t c_rc3_ = 2;
+	static const int64_t c_rl_ = 3;
+	static const int64_t c_rtv_ = 4;
+	static const int64_t c_r1_ = 5;
+	static const int64_t c_r2_ = 6;
+	static const int64_t c_r3_ = 7;
+	static const int64_t c_register_number_ = 8;
+	// label of a block: the entrance, the exit and labels generated in it (from 0)
+	static const int64_t c_in_label_ = -2;
+	static const int64_t c_out_label_ = -1;
+	static const char * s_op_name_table_[c_op_number_];
+	static const int64_t s_op_length_table_[c_op_number_];
+	static const char * s_register_name_table_[c_register_number_];
+	static const int64_t s_register_length_table_[c_register_number_];
+	static int64_t s_GetLabel(int64_t block, int64_t ordinal);
+	static int64_t s_GetLabelBlock(int64_t label);
+	static int64_t s_GetLabelOrdinal(int64_t label);
+	static int64_t s_ParseImmediate(const char * text, int64_t * value_p);
+	static int64_t s_FormatInteger(int64_t value, char * buffer);
 	CodeItem();
-	~CodeItem();
-	int64_t SetLabel(const char * label);
-	int64_t SetOp(const char * op);
-	int64_t SetDst(const char * dst);
-	int64_t SetSrc(const char * src);
-	// content
-	char * label_;
-	char * op_;
-	char * dst_;
-	char * src_;
+	CodeItem(int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src);
+	// content: 16 bytes (The target operand is never an immediate or a label, so 32 bits are enough for it.)
+	uint8_t op_;
+	uint8_t dst_kind_;
+	uint8_t src_kind_;
+	int32_t dst_;
+	int64_t src_;
 };
 
-CodeItem * CodeItem::s_Malloc()
-{
-	return new CodeItem();
-}
+const char * CodeItem::s_op_name_table_[c_op_number_] = { NULL, "MOV", "ADD", "SUB", "MUL", "DIV", "MOD", "CMP", "JMP", "JE", "JG", "JL", "CALL", "PARAMETER", "RET", "INPUT", "OUTPUT" };
+
+const int64_t CodeItem::s_op_length_table_[c_op_number_] = { 0, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 4, 9, 3, 5, 6 };
+
+const char * CodeItem::s_register_name_table_[c_register_number_] = { "RC1", "RC2", "RC3", "RL", "RTV", "R1", "R2", "R3" };
+
+const int64_t CodeItem::s_register_length_table_[c_register_number_] = { 3, 3, 3, 2, 3, 2, 2, 2 };
 
-void CodeItem::s_Free(CodeItem * code_item)
+int64_t CodeItem::s_GetLabel(int64_t block, int64_t ordinal)
 {
-	if (code_item != NULL)
+	// block in the high 32 bits, and "ordinal - c_in_label_" in the low 32 bits
+	if (block < 0)
 	{
-		delete code_item;
+		throw std::exception("Function \"int64_t CodeItem::s_GetLabel(int64_t block, int64_t ordinal)\" says: Invalid parameter \"block\".");
 	}
+	if (ordinal < c_in_label_)
+	{
+		throw std::exception("Function \"int64_t CodeItem::s_GetLabel(int64_t block, int64_t ordinal)\" says: Invalid parameter \"ordinal\".");
+	}
+	return (block << 32) | (ordinal - c_in_label_);
 }
 
-CodeItem::CodeItem()
+int64_t CodeItem::s_GetLabelBlock(int64_t label)
 {
-	label_ = NULL;
-	op_ = NULL;
-	dst_ = NULL;
-	src_ = NULL;
+	return label >> 32;
 }
 
-CodeItem::~CodeItem()
+int64_t CodeItem::s_GetLabelOrdinal(int64_t label)
 {
-	if (NULL == label_)
-	{
-		delete[] label_;
-		label_ = NULL;
-	}
-	if (NULL == op_)
-	{
-		delete[] op_;
-		op_ = NULL;
-	}
-	if (NULL == dst_)
-	{
-		delete[] dst_;
-		dst_ = NULL;
-	}
-	if (NULL == src_)
-	{
-		delete[] src_;
-		src_ = NULL;
-	}
+	return (label & 0xFFFFFFFF) + c_in_label_;
 }
 
-int64_t CodeItem::SetLabel(const char * label)
+int64_t CodeItem::s_ParseImmediate(const char * text, int64_t * value_p)
 {
-	if (NULL == label || "" == label)
+	// Return 1 if the text is an integer which is written back as it is ("-" and digits without leading "0", in 64-bit range), else -1.
+	if (NULL == text)
 	{
-		throw std::exception("Function \"int64_t CodeItem::SetLabel(const char * label)\" says: Invalid parameter \"label\".");
+		throw std::exception("Function \"int64_t CodeItem::s_ParseImmediate(const char * text, int64_t * value_p)\" says: Invalid parameter \"text\".");
 	}
-	if (label_ != NULL)
+	if (NULL == value_p)
 	{
-		delete[] label_;
-		label_ = NULL;
+		throw std::exception("Function \"int64_t CodeItem::s_ParseImmediate(const char * text, int64_t * value_p)\" says: Invalid parameter \"value_p\".");
 	}
-	label_ = new char[strlen(label) + 1];
-	if (NULL == label_)
+	bool is_negative = '-' == text[0];
+	const char * digit = is_negative ? text + 1 : text;
+	uint64_t value = 0;
+	uint64_t limit = is_negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+	if (digit[0] < '0' || digit[0] > '9' || ('0' == digit[0] && (is_negative || digit[1] != '\0')))
 	{
 		return -1;
 	}
-	strcpy(label_, label);
+	for (int64_t i = 0; digit[i] != '\0'; ++i)
+	{
+		if (digit[i] < '0' || digit[i] > '9' || value > (limit - (digit[i] - '0')) / 10)
+		{
+			return -1;
+		}
+		value = value * 10 + (digit[i] - '0');
+	}
+	*value_p = is_negative ? (int64_t)(0 - value) : (int64_t)value;
 	return 1;
 }
 
-int64_t CodeItem::SetOp(const char * op)
+int64_t CodeItem::s_FormatInteger(int64_t value, char * buffer)
 {
-	if (NULL == op || "" == op)
+	// the same text as "%I64d" without parsing a format, and return its length
+	if (NULL == buffer)
 	{
-		throw std::exception("Function \"int64_t CodeItem::SetOp(const char * op)\" says: Invalid parameter \"op\".");
+		throw std::exception("Function \"int64_t CodeItem::s_FormatInteger(int64_t value, char * buffer)\" says: Invalid parameter \"buffer\".");
 	}
-	if (op_ != NULL)
+	char digit[20];
+	int64_t digit_number = 0;
+	int64_t length = 0;
+	uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+	do
+	{
+		digit[digit_number++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude > 0);
+	if (value < 0)
 	{
-		delete[] op_;
-		op_ = NULL;
+		buffer[length++] = '-';
 	}
-	op_ = new char[strlen(op) + 1];
-	if (NULL == op_)
+	while (digit_number > 0)
 	{
-		return -1;
+		buffer[length++] = digit[--digit_number];
 	}
-	strcpy(op_, op);
-	return 1;
+	buffer[length] = '\0';
+	return length;
 }
 
-int64_t CodeItem::SetDst(const char * dst)
+CodeItem::CodeItem()
 {
-	if (NULL == dst || "" == dst)
-	{
-		throw std::exception("Function \"int64_t CodeItem::SetDst(const char * dst)\" says: Invalid parameter \"dst\".");
-	}
-	if (dst_ != NULL)
-	{
-		delete[] dst_;
-		dst_ = NULL;
-	}
-	dst_ = new char[strlen(dst) + 1];
-	if (NULL == dst_)
-	{
-		return -1;
-	}
-	strcpy(dst_, dst);
-	return 1;
+	op_ = c_label_;
+	dst_kind_ = c_none_;
+	src_kind_ = c_none_;
+	dst_ = -1;
+	src_ = -1;
 }
 
-int64_t CodeItem::SetSrc(const char * src)
+CodeItem::CodeItem(int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)
 {
-	if (NULL == src || "" == src)
-	{
-		throw std::exception("Function \"int64_t CodeItem::SetSrc(const char * src)\" says: Invalid parameter \"src\".");
-	}
-	if (src_ != NULL)
-	{
-		delete[] src_;
-		src_ = NULL;
-	}
-	src_ = new char[strlen(src) + 1];
-	if (NULL == src_)
-	{
-		return -1;
-	}
-	strcpy(src_, src);
-	return 1;
+	op_ = op;
+	dst_kind_ = dst_kind;
+	src_kind_ = src_kind;
+	dst_ = dst;
+	src_ = src;
 }
 
 #endif
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <exception>
+#include <mutex>
+#include <atomic>
 #include "source_file.h"
 
 class Error
@@ -16,6 +18,8 @@ public:
 	// variable
 	int64_t major_no_;
 	int64_t minor_no_;
+	// location in the source file where the error is shown (-1 for where the source file is)
+	int64_t location_;
 private:
 	// variable
 	int64_t error_no_;
@@ -28,6 +32,7 @@ Error::Error()
 {
 	major_no_ = -1;
 	minor_no_ = -1;
+	location_ = -1;
 	error_no_ = -1;
 	display_line_ = -1;
 	display_offset_ = -1;
@@ -41,6 +46,11 @@ char * Error::GetErrorString(SourceFile * source_file_p)
 		throw std::exception("Function \"char * Error::GetErrorString(SourceFile * source_file_p)\" says: Invalid parameter \"source_file_p\".");
 	}
 	error_no_ = (major_no_ << 12) + minor_no_;
+	if (location_ >= 0)
+	{
+		source_file_p->JumpTo(location_);
+	}
+	source_file_p->LocateLine();
 	display_line_ = source_file_p->line_index_ + 1;
 	display_offset_ = source_file_p->index_ - source_file_p->line_ + 1;
 	switch (error_no_)
@@ -120,6 +130,15 @@ char * Error::GetErrorString(SourceFile * source_file_p)
 	case 0x5001:
 		sprintf(error_string_, "[0x%04I64X] Fail to open intermediate file.", error_no_);
 		break;
+	case 0x5002:
+		sprintf(error_string_, "[0x%04I64X] Fail to write binary intermediate file.", error_no_);
+		break;
+	case 0x5003:
+		sprintf(error_string_, "[0x%04I64X] Fail to read intermediate file.", error_no_);
+		break;
+	case 0x5004:
+		sprintf(error_string_, "[0x%04I64X] The intermediate file is invalid.", error_no_);
+		break;
 	default:
 		error_string_[0] = '\0';
 		break;
@@ -127,4 +146,59 @@ char * Error::GetErrorString(SourceFile * source_file_p)
 	return error_string_;
 }
 
+class FirstError
+{
+public:
+	// the error of the first task which fails, in the order of tasks (the one reported if they run one by one)
+	FirstError(int64_t task_number);
+	bool IsSkipped(int64_t task);
+	void Fail(int64_t task, Error * error_p);
+	int64_t Report(Error * error_p);
+private:
+	std::mutex mutex_;
+	std::atomic<int64_t> task_;
+	Error error_;
+};
+
+FirstError::FirstError(int64_t task_number)
+{
+	task_ = task_number;
+}
+
+bool FirstError::IsSkipped(int64_t task)
+{
+	// A task after the failed one would never run one by one.
+	return task > task_;
+}
+
+void FirstError::Fail(int64_t task, Error * error_p)
+{
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"void FirstError::Fail(int64_t task, Error * error_p)\" says: Invalid parameter \"error_p\".");
+	}
+	std::unique_lock<std::mutex> lock(mutex_);
+	if (task < task_)
+	{
+		task_ = task;
+		error_ = *error_p;
+	}
+}
+
+int64_t FirstError::Report(Error * error_p)
+{
+	// Return -1 with the error if a task has failed.
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t FirstError::Report(Error * error_p)\" says: Invalid parameter \"error_p\".");
+	}
+	std::unique_lock<std::mutex> lock(mutex_);
+	if (error_.major_no_ < 0)
+	{
+		return 1;
+	}
+	*error_p = error_;
+	return -1;
+}
+
 #endif
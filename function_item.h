@@ -8,7 +8,9 @@
 #include <exception>
 #include "block.h"
 #include "variable_item.h"
-#include "word.h"
+#include "token_stream.h"
+#include "code_item.h"
+#include "arena.h"
 
 class FunctionItem
 {
@@ -21,16 +23,18 @@ public:
 	// location
 	int64_t beginning_;
 	int64_t end_;
-	// block
+	// block: the outermost block of the function (It is owned by "BlockTree".)
 	Block * block_tree;
 	// name
 	char * name_;
-	// information
+	int32_t name_id_; // id of the name in "Interner::s_interner_"
+	// information: Parameters are in the arena, and they are freed with the function.
+	Arena arena;
 	int64_t return_type_;
 	std::vector<VariableItem *> parameter_table_;
-	Word word_header; // It is a linked list.
-	std::vector<CodeItem *> intermediate;
-	std::vector<CodeItem *> assembler;
+	TokenStream token_stream; // It is a struct of arrays.
+	std::vector<CodeItem> intermediate; // contiguous
+	std::vector<CodeItem> assembler;
 };
 
 FunctionItem * FunctionItem::s_Malloc()
@@ -52,6 +56,7 @@ FunctionItem::FunctionItem()
 	end_ = -1;
 	block_tree = NULL;
 	name_ = NULL;
+	name_id_ = -1;
 	return_type_ = -1;
 }
 
@@ -62,16 +67,7 @@ FunctionItem::~FunctionItem()
 		delete[] name_;
 		name_ = NULL;
 	}
-	if (block_tree != NULL)
-	{
-		Block::s_FreeAll(block_tree);
-		block_tree = NULL;
-	}
-	for (int64_t i = 0; i < parameter_table_.size(); ++i)
-	{
-		VariableItem::s_Free(parameter_table_[i]);
-		parameter_table_[i] = NULL;
-	}
+	block_tree = NULL;
 }
 
 int64_t FunctionItem::SetName(const char * name)
@@ -0,0 +1,284 @@
+#ifndef GRAMMAR_TABLE_H_
+#define GRAMMAR_TABLE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <exception>
+#include "parser_item.h"
+
+class GrammarTable
+{
+public:
+	// terminal symbols (see function "TokenStream::s_GetSymbol") and productions
+	static const int64_t c_terminal_number_ = 28;
+	static const int64_t c_production_number_ = 25;
+	static const int64_t c_max_right_length_ = 9;
+	// relation of 2 terminal symbols: 2 bits
+	static const int64_t c_undefined_ = 0;
+	static const int64_t c_less_than_ = 1;
+	static const int64_t c_equal_to_ = 2;
+	static const int64_t c_greater_than_ = 3;
+	static const int64_t c_relation_range_number_ = 78;
+	// hash of productions by signature (the symbols of the right part)
+	static const int64_t c_production_slot_number_ = 64;
+	static int64_t s_GetRelation(int64_t left, int64_t right);
+	static int64_t s_SearchProduction(const int64_t * phrase, int64_t length);
+	// right part of productions: "ParserItem::c_vn_" for a nonterminal symbol
+	static const int64_t s_right_table_[c_production_number_][c_max_right_length_];
+	static const int64_t s_right_length_table_[c_production_number_];
+	// false if there is a conflict in "s_relation_description_" or "s_right_table_": It is checked once in function "main", not in each lookup.
+	static bool s_built_;
+private:
+	// Each row is a "uint64_t" with 2 bits for each column.
+	static uint64_t s_relation_table_[c_terminal_number_];
+	// { left, first right, last right, relation }
+	static const int64_t s_relation_description_[c_relation_range_number_][4];
+	static int64_t s_production_signature_table_[c_production_slot_number_];
+	static int64_t s_production_slot_table_[c_production_slot_number_]; // production, or -1
+	static int64_t s_GetSignature(const int64_t * phrase, int64_t length);
+	static bool s_BuildRelationTable();
+	static bool s_BuildProductionTable();
+};
+
+const int64_t GrammarTable::s_right_table_[c_production_number_][c_max_right_length_] =
+{
+	// 0: N ;
+	{ ParserItem::c_vn_, 14, 0, 0, 0, 0, 0, 0, 0 },
+	// 1: if ( N ) { }
+	{ 19, 8, ParserItem::c_vn_, 9, 16, 17, 0, 0, 0 },
+	// 2: if ( N ) { } else { }
+	{ 19, 8, ParserItem::c_vn_, 9, 16, 17, 20, 16, 17 },
+	// 3: while ( N ) { }
+	{ 21, 8, ParserItem::c_vn_, 9, 16, 17, 0, 0, 0 },
+	// 4: return N ;
+	{ 22, ParserItem::c_vn_, 14, 0, 0, 0, 0, 0, 0 },
+	// 5: input $$ i $$ ;
+	{ 23, 1, 26, 1, 14, 0, 0, 0, 0 },
+	// 6: output $$ i $$ ;
+	{ 24, 1, 26, 1, 14, 0, 0, 0, 0 },
+	// 7: i = N
+	{ 26, 2, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 8: i = $ N $
+	{ 26, 2, 0, ParserItem::c_vn_, 0, 0, 0, 0, 0 },
+	// 9: N + N
+	{ ParserItem::c_vn_, 3, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 10: N - N
+	{ ParserItem::c_vn_, 4, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 11: N * N
+	{ ParserItem::c_vn_, 5, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 12: N / N
+	{ ParserItem::c_vn_, 6, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 13: N % N
+	{ ParserItem::c_vn_, 7, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 14: ( N )
+	{ 8, ParserItem::c_vn_, 9, 0, 0, 0, 0, 0, 0 },
+	// 15: const
+	{ 25, 0, 0, 0, 0, 0, 0, 0, 0 },
+	// 16: i
+	{ 26, 0, 0, 0, 0, 0, 0, 0, 0 },
+	// 17: int i
+	{ 18, 26, 0, 0, 0, 0, 0, 0, 0 },
+	// 18: i ( N )
+	{ 26, 8, ParserItem::c_vn_, 9, 0, 0, 0, 0, 0 },
+	// 19: i ( )
+	{ 26, 8, 9, 0, 0, 0, 0, 0, 0 },
+	// 20: N , N
+	{ ParserItem::c_vn_, 15, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 21: N > N
+	{ ParserItem::c_vn_, 10, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 22: N < N
+	{ ParserItem::c_vn_, 11, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 23: N == N
+	{ ParserItem::c_vn_, 12, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0 },
+	// 24: ! N
+	{ 13, ParserItem::c_vn_, 0, 0, 0, 0, 0, 0, 0 }
+};
+
+const int64_t GrammarTable::s_right_length_table_[c_production_number_] =
+{
+	2, 6, 9, 6, 3, 5, 5, 3, 5, 3, 3, 3, 3, 3, 3, 1, 1, 2, 4, 3, 3, 3, 3, 3, 2
+};
+
+const int64_t GrammarTable::s_relation_description_[c_relation_range_number_][4] =
+{
+	// = : 18 items
+	{ 0, 0, 0, c_equal_to_ },
+	{ 1, 14, 14, c_equal_to_ },
+	{ 1, 26, 26, c_equal_to_ },
+	{ 2, 0, 0, c_equal_to_ },
+	{ 8, 9, 9, c_equal_to_ },
+	{ 9, 16, 16, c_equal_to_ },
+	{ 16, 17, 17, c_equal_to_ },
+	{ 17, 20, 20, c_equal_to_ },
+	{ 18, 26, 26, c_equal_to_ },
+	{ 19, 8, 8, c_equal_to_ },
+	{ 20, 16, 16, c_equal_to_ },
+	{ 21, 8, 8, c_equal_to_ },
+	{ 22, 14, 14, c_equal_to_ },
+	{ 23, 1, 1, c_equal_to_ },
+	{ 24, 1, 1, c_equal_to_ },
+	{ 26, 1, 2, c_equal_to_ },
+	{ 26, 8, 8, c_equal_to_ },
+	// < : 59 + 27 items
+	{ 0, 26, 26, c_less_than_ },
+	{ 2, 3, 8, c_less_than_ },
+	{ 2, 25, 26, c_less_than_ },
+	{ 3, 5, 8, c_less_than_ },
+	{ 3, 25, 26, c_less_than_ },
+	{ 4, 5, 8, c_less_than_ },
+	{ 4, 25, 26, c_less_than_ },
+	{ 5, 8, 8, c_less_than_ },
+	{ 5, 25, 26, c_less_than_ },
+	{ 6, 8, 8, c_less_than_ },
+	{ 6, 25, 26, c_less_than_ },
+	{ 7, 8, 8, c_less_than_ },
+	{ 7, 25, 26, c_less_than_ },
+	{ 8, 3, 8, c_less_than_ },
+	{ 8, 10, 13, c_less_than_ },
+	{ 8, 15, 15, c_less_than_ },
+	{ 8, 25, 26, c_less_than_ },
+	{ 10, 25, 26, c_less_than_ },
+	{ 11, 25, 26, c_less_than_ },
+	{ 12, 25, 26, c_less_than_ },
+	{ 13, 10, 13, c_less_than_ },
+	{ 13, 25, 26, c_less_than_ },
+	{ 15, 25, 26, c_less_than_ },
+	{ 22, 25, 26, c_less_than_ },
+	{ 27, 1, 26, c_less_than_ },
+	// > : 67 + 27 + 26 items
+	{ 0, 14, 14, c_greater_than_ },
+	{ 2, 14, 14, c_greater_than_ },
+	{ 3, 3, 4, c_greater_than_ },
+	{ 3, 9, 9, c_greater_than_ },
+	{ 3, 14, 14, c_greater_than_ },
+	{ 4, 3, 4, c_greater_than_ },
+	{ 4, 9, 9, c_greater_than_ },
+	{ 4, 14, 14, c_greater_than_ },
+	{ 5, 3, 7, c_greater_than_ },
+	{ 5, 9, 9, c_greater_than_ },
+	{ 5, 14, 14, c_greater_than_ },
+	{ 6, 3, 7, c_greater_than_ },
+	{ 6, 9, 9, c_greater_than_ },
+	{ 6, 14, 14, c_greater_than_ },
+	{ 7, 3, 7, c_greater_than_ },
+	{ 7, 9, 9, c_greater_than_ },
+	{ 7, 14, 14, c_greater_than_ },
+	{ 9, 0, 0, c_greater_than_ },
+	{ 9, 3, 7, c_greater_than_ },
+	{ 9, 9, 9, c_greater_than_ },
+	{ 9, 14, 14, c_greater_than_ },
+	{ 10, 9, 9, c_greater_than_ },
+	{ 11, 9, 9, c_greater_than_ },
+	{ 12, 9, 9, c_greater_than_ },
+	{ 13, 9, 9, c_greater_than_ },
+	{ 15, 9, 9, c_greater_than_ },
+	{ 15, 14, 14, c_greater_than_ },
+	{ 25, 3, 7, c_greater_than_ },
+	{ 25, 9, 12, c_greater_than_ },
+	{ 25, 14, 15, c_greater_than_ },
+	{ 26, 3, 7, c_greater_than_ },
+	{ 26, 9, 12, c_greater_than_ },
+	{ 26, 14, 15, c_greater_than_ },
+	{ 14, 1, 26, c_greater_than_ },
+	{ 17, 1, 19, c_greater_than_ },
+	{ 17, 21, 26, c_greater_than_ }
+};
+
+uint64_t GrammarTable::s_relation_table_[c_terminal_number_];
+int64_t GrammarTable::s_production_signature_table_[c_production_slot_number_];
+int64_t GrammarTable::s_production_slot_table_[c_production_slot_number_];
+
+bool GrammarTable::s_built_ = GrammarTable::s_BuildRelationTable() && GrammarTable::s_BuildProductionTable();
+
+bool GrammarTable::s_BuildRelationTable()
+{
+	// Build "s_relation_table_" from "s_relation_description_" before function "main". A cell must not have 2 relations.
+	int64_t left;
+	int64_t relation;
+	int64_t relation_now;
+	for (int64_t i = 0; i < c_terminal_number_; ++i)
+	{
+		s_relation_table_[i] = 0;
+	}
+	for (int64_t i = 0; i < c_relation_range_number_; ++i)
+	{
+		left = s_relation_description_[i][0];
+		relation = s_relation_description_[i][3];
+		for (int64_t right = s_relation_description_[i][1]; right <= s_relation_description_[i][2]; ++right)
+		{
+			relation_now = (s_relation_table_[left] >> (2 * right)) & 3;
+			if (c_undefined_ != relation_now && relation != relation_now)
+			{
+				return false;
+			}
+			s_relation_table_[left] |= uint64_t(relation) << (2 * right);
+		}
+	}
+	return true;
+}
+
+bool GrammarTable::s_BuildProductionTable()
+{
+	// Build the hash of productions before function "main". Productions must have different signatures.
+	int64_t signature;
+	int64_t slot;
+	for (int64_t i = 0; i < c_production_slot_number_; ++i)
+	{
+		s_production_signature_table_[i] = -1;
+		s_production_slot_table_[i] = -1;
+	}
+	for (int64_t i = 0; i < c_production_number_; ++i)
+	{
+		signature = s_GetSignature(s_right_table_[i], s_right_length_table_[i]);
+		for (slot = signature % c_production_slot_number_; s_production_slot_table_[slot] != -1; slot = (slot + 1) % c_production_slot_number_)
+		{
+			if (signature == s_production_signature_table_[slot])
+			{
+				return false;
+			}
+		}
+		s_production_signature_table_[slot] = signature;
+		s_production_slot_table_[slot] = i;
+	}
+	return true;
+}
+
+int64_t GrammarTable::s_GetSignature(const int64_t * phrase, int64_t length)
+{
+	// the length and the symbols as digits of base "c_terminal_number_ + 1" ("ParserItem::c_vn_" is 0): It is exact, and less than 10 * 29 ^ 9.
+	int64_t signature = length;
+	for (int64_t i = 0; i < length; ++i)
+	{
+		signature = signature * (c_terminal_number_ + 1) + phrase[i] - ParserItem::c_vn_;
+	}
+	return signature;
+}
+
+int64_t GrammarTable::s_SearchProduction(const int64_t * phrase, int64_t length)
+{
+	// Return the production whose right part is "phrase", or -1.
+	if (NULL == phrase)
+	{
+		throw std::exception("Function \"int64_t GrammarTable::s_SearchProduction(const int64_t * phrase, int64_t length)\" says: Invalid parameter \"phrase\".");
+	}
+	if (length <= 0 || length > c_max_right_length_)
+	{
+		return -1;
+	}
+	int64_t signature = s_GetSignature(phrase, length);
+	for (int64_t slot = signature % c_production_slot_number_; s_production_slot_table_[slot] != -1; slot = (slot + 1) % c_production_slot_number_)
+	{
+		if (signature == s_production_signature_table_[slot])
+		{
+			return s_production_slot_table_[slot];
+		}
+	}
+	return -1;
+}
+
+int64_t GrammarTable::s_GetRelation(int64_t left, int64_t right)
+{
+	return (s_relation_table_[left] >> (2 * right)) & 3;
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef INTERNER_H_
+#define INTERNER_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <exception>
+#include <mutex>
+#include <atomic>
+#include "arena.h"
+
+class Interner
+{
+public:
+	// shard: A spelling is kept in the shard chosen by its hash, and each shard has its own lock.
+	static const int64_t c_shard_number_ = 16;
+	static const int64_t c_first_slot_number_ = 256;
+	// page of spellings (indexed by id): Pages are never moved, so they are read without lock.
+	static const int64_t c_page_size_ = 1024;
+	static const int64_t c_page_number_ = 65536;
+	// the interner shared by the whole program
+	static Interner s_interner_;
+	Interner();
+	~Interner();
+	int32_t Intern(const char * text, int64_t length);
+	int32_t Search(const char * text, int64_t length);
+	const char * GetText(int32_t id);
+	int64_t GetLength(int32_t id);
+	// number of ids: Ids are dense, from 0 to "size_ - 1".
+	std::atomic<int32_t> size_;
+private:
+	class Spelling
+	{
+	public:
+		const char * text_;
+		int64_t length_;
+		uint32_t hash_;
+	};
+	class Shard
+	{
+	public:
+		std::mutex mutex_;
+		// open addressing: id in each slot, or -1
+		std::vector<int32_t> slot_table_;
+		int64_t used_;
+		// text of spellings
+		Arena arena_;
+	};
+	Interner(const Interner &);
+	Interner & operator=(const Interner &);
+	static uint32_t s_Hash(const char * text, int64_t length);
+	Spelling * GetSpelling(int32_t id);
+	int32_t SearchInShard(Shard * shard_p, const char * text, int64_t length, uint32_t hash, int64_t * slot_p);
+	Shard shard_table_[c_shard_number_];
+	Spelling * page_table_[c_page_number_];
+	std::mutex page_mutex_;
+};
+
+Interner Interner::s_interner_;
+
+Interner::Interner()
+{
+	size_ = 0;
+	for (int64_t i = 0; i < c_shard_number_; ++i)
+	{
+		shard_table_[i].slot_table_.assign(c_first_slot_number_, -1);
+		shard_table_[i].used_ = 0;
+	}
+	for (int64_t i = 0; i < c_page_number_; ++i)
+	{
+		page_table_[i] = NULL;
+	}
+}
+
+Interner::~Interner()
+{
+	for (int64_t i = 0; i < c_page_number_; ++i)
+	{
+		if (page_table_[i] != NULL)
+		{
+			delete[] page_table_[i];
+			page_table_[i] = NULL;
+		}
+	}
+}
+
+int32_t Interner::Intern(const char * text, int64_t length)
+{
+	// Return the id of the spelling, and give it a new id if it is met for the first time.
+	if (NULL == text)
+	{
+		throw std::exception("Function \"int32_t Interner::Intern(const char * text, int64_t length)\" says: Invalid parameter \"text\".");
+	}
+	if (length <= 0)
+	{
+		throw std::exception("Function \"int32_t Interner::Intern(const char * text, int64_t length)\" says: Invalid parameter \"length\".");
+	}
+	uint32_t hash = s_Hash(text, length);
+	Shard * shard_p = &(shard_table_[hash % c_shard_number_]);
+	std::unique_lock<std::mutex> lock(shard_p->mutex_);
+	int64_t slot;
+	int32_t id = SearchInShard(shard_p, text, length, hash, &slot);
+	if (id != -1)
+	{
+		return id;
+	}
+	// new spelling
+	char * copy = (char *)shard_p->arena_.Allocate(length + 1);
+	if (NULL == copy)
+	{
+		throw std::exception("Function \"int32_t Interner::Intern(const char * text, int64_t length)\" says: Out of memory.");
+	}
+	memcpy(copy, text, length);
+	copy[length] = '\0';
+	id = size_++;
+	if (id >= c_page_size_ * c_page_number_)
+	{
+		throw std::exception("Function \"int32_t Interner::Intern(const char * text, int64_t length)\" says: Too many spellings.");
+	}
+	{
+		std::unique_lock<std::mutex> page_lock(page_mutex_);
+		if (NULL == page_table_[id / c_page_size_])
+		{
+			page_table_[id / c_page_size_] = new Spelling[c_page_size_];
+		}
+	}
+	Spelling * spelling_p = GetSpelling(id);
+	spelling_p->text_ = copy;
+	spelling_p->length_ = length;
+	spelling_p->hash_ = hash;
+	shard_p->slot_table_[slot] = id;
+	shard_p->used_ += 1;
+	// rehash: Keep the load factor under 1/2.
+	if (shard_p->used_ * 2 > shard_p->slot_table_.size())
+	{
+		std::vector<int32_t> slot_table(shard_p->slot_table_.size() * 2, -1);
+		int64_t mask = slot_table.size() - 1;
+		for (int64_t i = 0; i < shard_p->slot_table_.size(); ++i)
+		{
+			if (shard_p->slot_table_[i] != -1)
+			{
+				for (slot = (GetSpelling(shard_p->slot_table_[i])->hash_ / c_shard_number_) & mask; slot_table[slot] != -1; slot = (slot + 1) & mask)
+					;
+				slot_table[slot] = shard_p->slot_table_[i];
+			}
+		}
+		shard_p->slot_table_.swap(slot_table);
+	}
+	return id;
+}
+
+int32_t Interner::Search(const char * text, int64_t length)
+{
+	// Return the id of the spelling, or -1 if it has never been interned.
+	if (NULL == text)
+	{
+		throw std::exception("Function \"int32_t Interner::Search(const char * text, int64_t length)\" says: Invalid parameter \"text\".");
+	}
+	if (length <= 0)
+	{
+		return -1;
+	}
+	uint32_t hash = s_Hash(text, length);
+	Shard * shard_p = &(shard_table_[hash % c_shard_number_]);
+	std::unique_lock<std::mutex> lock(shard_p->mutex_);
+	int64_t slot;
+	return SearchInShard(shard_p, text, length, hash, &slot);
+}
+
+const char * Interner::GetText(int32_t id)
+{
+	// The text is terminated by '\0'.
+	if (id < 0 || id >= size_)
+	{
+		throw std::exception("Function \"const char * Interner::GetText(int32_t id)\" says: Invalid parameter \"id\".");
+	}
+	return GetSpelling(id)->text_;
+}
+
+int64_t Interner::GetLength(int32_t id)
+{
+	if (id < 0 || id >= size_)
+	{
+		throw std::exception("Function \"int64_t Interner::GetLength(int32_t id)\" says: Invalid parameter \"id\".");
+	}
+	return GetSpelling(id)->length_;
+}
+
+uint32_t Interner::s_Hash(const char * text, int64_t length)
+{
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	for (int64_t i = 0; i < length; ++i)
+	{
+		hash ^= (unsigned char)text[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+Interner::Spelling * Interner::GetSpelling(int32_t id)
+{
+	return &(page_table_[id / c_page_size_][id % c_page_size_]);
+}
+
+int32_t Interner::SearchInShard(Shard * shard_p, const char * text, int64_t length, uint32_t hash, int64_t * slot_p)
+{
+	// linear probing: Return the id, or -1 with the empty slot for it. The lock of the shard must be held.
+	int64_t mask = shard_p->slot_table_.size() - 1;
+	Spelling * spelling_p;
+	int64_t slot;
+	for (slot = (hash / c_shard_number_) & mask; shard_p->slot_table_[slot] != -1; slot = (slot + 1) & mask)
+	{
+		spelling_p = GetSpelling(shard_p->slot_table_[slot]);
+		if (spelling_p->hash_ == hash && spelling_p->length_ == length && 0 == memcmp(spelling_p->text_, text, length))
+		{
+			return shard_p->slot_table_[slot];
+		}
+	}
+	*slot_p = slot;
+	return -1;
+}
+
+#endif
@@ -0,0 +1,797 @@
+#ifndef IR_FILE_H_
+#define IR_FILE_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <exception>
+#include "code_item.h"
+#include "source_file.h"
+
+class IrFile
+{
+public:
+	// image: header, listings (function heads, then blocks), codes, labels, offsets of strings and text of strings, each array aligned to 8 bytes
+	// It has no pointer, so a mapped file is read in place.
+	class Header
+	{
+	public:
+		char magic_[8];
+		int64_t version_;
+		int64_t size_; // bytes of the image
+		int64_t listing_number_;
+		int64_t listing_offset_;
+		int64_t code_number_;
+		int64_t code_offset_;
+		int64_t label_number_;
+		int64_t label_offset_;
+		int64_t string_number_;
+		int64_t string_offset_; // "string_number_ + 1" offsets in the text
+		int64_t text_offset_;
+	};
+	class Listing
+	{
+	public:
+		int64_t code_beginning_;
+		int64_t code_number_;
+	};
+	class Label
+	{
+	public:
+		int64_t string_;
+		int64_t code_; // the code which defines the label
+	};
+	// Operands of kind "c_label_id_", "c_function_" and "c_variable_" (a variable, or a word written as it is) are string ids in the image.
+	static const char s_magic_[8];
+	static const int64_t c_version_ = 1;
+	static int64_t s_IsImage(const char * path);
+	IrFile();
+	// building: Codes are appended to the last listing, and function "Build" makes the image.
+	void AppendListing();
+	void AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text);
+	void Build();
+	// file
+	int64_t Save(const char * path);
+	int64_t Load(const char * path);
+	int64_t ReadText(const char * path);
+	int64_t WriteText(const char * path);
+	const char * GetString(int64_t id);
+	// view of the image (after "Build", "Load" or "ReadText")
+	const Header * header_;
+	const Listing * listing_table_;
+	const CodeItem * code_table_;
+	const Label * label_table_;
+	const int64_t * string_offset_table_;
+	const char * text_;
+	// line where function "ReadText" fails (from 1)
+	int64_t error_line_;
+	// bytes of the last file read by function "Load" or "ReadText"
+	int64_t file_size_;
+private:
+	static int64_t s_Align(int64_t size);
+	static uint32_t s_Hash(const char * text, int64_t length);
+	void Clear();
+	int64_t ReadFile(const char * path);
+	int64_t AppendString(const char * text, int64_t length);
+	void AppendItem(int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src);
+	int64_t ReadCode(const char * line, int64_t length);
+	int64_t ReadOperand(const char * text, int64_t length, bool is_dst, int64_t op, int64_t * kind_p, int64_t * value_p);
+	int64_t SetView(const char * image, int64_t size);
+	// building
+	std::vector<Listing> listing_buffer_;
+	std::vector<CodeItem> code_buffer_;
+	std::vector<Label> label_buffer_;
+	std::vector<int64_t> string_offset_buffer_;
+	std::vector<char> text_buffer_;
+	// strings: open addressing (string id + 1 in each slot, 0 if empty), at most half full
+	std::vector<int64_t> string_slot_table_;
+	std::vector<uint32_t> string_hash_buffer_;
+	// image: built on heap, or the content of a file (mapped if possible)
+	std::vector<int64_t> image_buffer_; // aligned to 8 bytes
+	SourceFile file_;
+	const char * image_;
+};
+
+const char IrFile::s_magic_[8] = { 'C', 'L', 'I', 'K', 'E', 'I', 'R', '\0' };
+
+int64_t IrFile::s_IsImage(const char * path)
+{
+	// Return 1 if the file begins with the magic, else 0 (-1 if it can not be opened).
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t IrFile::s_IsImage(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	char magic[8];
+	FILE * fp = fopen(path, "rb");
+	if (NULL == fp)
+	{
+		return -1;
+	}
+	int64_t result = 8 == fread(magic, 1, 8, fp) && 0 == memcmp(magic, s_magic_, 8) ? 1 : 0;
+	fclose(fp);
+	return result;
+}
+
+IrFile::IrFile()
+{
+	header_ = NULL;
+	listing_table_ = NULL;
+	code_table_ = NULL;
+	label_table_ = NULL;
+	string_offset_table_ = NULL;
+	text_ = NULL;
+	error_line_ = -1;
+	file_size_ = 0;
+	image_ = NULL;
+}
+
+int64_t IrFile::s_Align(int64_t size)
+{
+	return (size + 7) / 8 * 8;
+}
+
+void IrFile::Clear()
+{
+	listing_buffer_.clear();
+	code_buffer_.clear();
+	label_buffer_.clear();
+	string_offset_buffer_.clear();
+	text_buffer_.clear();
+	string_slot_table_.clear();
+	string_hash_buffer_.clear();
+	image_buffer_.clear();
+	file_.Free();
+	header_ = NULL;
+	listing_table_ = NULL;
+	code_table_ = NULL;
+	label_table_ = NULL;
+	string_offset_table_ = NULL;
+	text_ = NULL;
+	image_ = NULL;
+}
+
+void IrFile::AppendListing()
+{
+	Listing listing;
+	listing.code_beginning_ = code_buffer_.size();
+	listing.code_number_ = 0;
+	listing_buffer_.push_back(listing);
+}
+
+void IrFile::AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text)
+{
+	// The text of an operand is used instead of its value if the operand is a name. A word becomes a variable, and the function of a label becomes a label, since both are only names in the image.
+	if (listing_buffer_.empty())
+	{
+		throw std::exception("Function \"void IrFile::AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text)\" says: There is no listing.");
+	}
+	if (op < 0 || op >= CodeItem::c_op_number_)
+	{
+		throw std::exception("Function \"void IrFile::AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text)\" says: Invalid parameter \"op\".");
+	}
+	if (CodeItem::c_word_ == dst_kind)
+	{
+		dst_kind = CodeItem::c_variable_;
+	}
+	if (CodeItem::c_word_ == src_kind || (CodeItem::c_function_ == src_kind && CodeItem::c_label_ == op))
+	{
+		src_kind = CodeItem::c_word_ == src_kind ? CodeItem::c_variable_ : CodeItem::c_label_id_;
+	}
+	if (CodeItem::c_variable_ == dst_kind)
+	{
+		if (NULL == dst_text)
+		{
+			throw std::exception("Function \"void IrFile::AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text)\" says: Invalid parameter \"dst_text\".");
+		}
+		dst = AppendString(dst_text, strlen(dst_text));
+	}
+	if (CodeItem::c_variable_ == src_kind || CodeItem::c_label_id_ == src_kind || CodeItem::c_function_ == src_kind)
+	{
+		if (NULL == src_text)
+		{
+			throw std::exception("Function \"void IrFile::AppendCode(int64_t op, int64_t dst_kind, int64_t dst, const char * dst_text, int64_t src_kind, int64_t src, const char * src_text)\" says: Invalid parameter \"src_text\".");
+		}
+		src = AppendString(src_text, strlen(src_text));
+	}
+	AppendItem(op, dst_kind, dst, src_kind, src);
+}
+
+void IrFile::AppendItem(int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)
+{
+	// Names are string ids here.
+	if (CodeItem::c_label_ == op && CodeItem::c_label_id_ == src_kind)
+	{
+		Label label;
+		label.string_ = src;
+		label.code_ = code_buffer_.size();
+		label_buffer_.push_back(label);
+	}
+	code_buffer_.push_back(CodeItem(op, dst_kind, dst, src_kind, src));
+	listing_buffer_[listing_buffer_.size() - 1].code_number_ += 1;
+}
+
+int64_t IrFile::AppendString(const char * text, int64_t length)
+{
+	// Return the id of the string. Each string is kept once.
+	uint32_t hash = s_Hash(text, length);
+	int64_t string_number = string_offset_buffer_.size();
+	int64_t mask;
+	int64_t slot;
+	int64_t id;
+	if (2 * (string_number + 1) > string_slot_table_.size())
+	{
+		// grow, and put the strings again by their hashes
+		string_slot_table_.assign(string_slot_table_.size() > 0 ? 2 * string_slot_table_.size() : 1024, 0);
+		mask = string_slot_table_.size() - 1;
+		for (int64_t i = 0; i < string_number; ++i)
+		{
+			for (slot = string_hash_buffer_[i] & mask; 0 != string_slot_table_[slot]; slot = (slot + 1) & mask)
+			{
+			}
+			string_slot_table_[slot] = i + 1;
+		}
+	}
+	mask = string_slot_table_.size() - 1;
+	for (slot = hash & mask; 0 != string_slot_table_[slot]; slot = (slot + 1) & mask)
+	{
+		id = string_slot_table_[slot] - 1;
+		if (hash == string_hash_buffer_[id] && length == (id + 1 < string_number ? string_offset_buffer_[id + 1] : (int64_t)text_buffer_.size()) - string_offset_buffer_[id] - 1 && 0 == memcmp(&(text_buffer_[string_offset_buffer_[id]]), text, length))
+		{
+			return id;
+		}
+	}
+	string_slot_table_[slot] = string_number + 1;
+	string_hash_buffer_.push_back(hash);
+	string_offset_buffer_.push_back(text_buffer_.size());
+	text_buffer_.insert(text_buffer_.end(), text, text + length);
+	text_buffer_.push_back('\0');
+	return string_number;
+}
+
+uint32_t IrFile::s_Hash(const char * text, int64_t length)
+{
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	for (int64_t i = 0; i < length; ++i)
+	{
+		hash ^= (uint8_t)text[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+void IrFile::Build()
+{
+	Header header;
+	int64_t offset;
+	memset(&header, 0, sizeof(Header));
+	memcpy(header.magic_, s_magic_, 8);
+	header.version_ = c_version_;
+	header.listing_number_ = listing_buffer_.size();
+	header.code_number_ = code_buffer_.size();
+	header.label_number_ = label_buffer_.size();
+	header.string_number_ = string_offset_buffer_.size();
+	offset = s_Align(sizeof(Header));
+	header.listing_offset_ = offset;
+	offset += s_Align(header.listing_number_ * sizeof(Listing));
+	header.code_offset_ = offset;
+	offset += s_Align(header.code_number_ * sizeof(CodeItem));
+	header.label_offset_ = offset;
+	offset += s_Align(header.label_number_ * sizeof(Label));
+	header.string_offset_ = offset;
+	offset += s_Align((header.string_number_ + 1) * sizeof(int64_t));
+	header.text_offset_ = offset;
+	offset += text_buffer_.size();
+	header.size_ = offset;
+	// copy: The padding is zero, so the same codes always make the same image.
+	string_offset_buffer_.push_back(text_buffer_.size());
+	image_buffer_.assign(s_Align(header.size_) / 8, 0);
+	char * image = (char *)&(image_buffer_[0]);
+	memcpy(image, &header, sizeof(Header));
+	if (header.listing_number_ > 0)
+	{
+		memcpy(image + header.listing_offset_, &(listing_buffer_[0]), header.listing_number_ * sizeof(Listing));
+	}
+	// Codes are copied by fields, so their padding stays zero too.
+	CodeItem * code_table = (CodeItem *)(image + header.code_offset_);
+	for (int64_t i = 0; i < header.code_number_; ++i)
+	{
+		code_table[i].op_ = code_buffer_[i].op_;
+		code_table[i].dst_kind_ = code_buffer_[i].dst_kind_;
+		code_table[i].src_kind_ = code_buffer_[i].src_kind_;
+		code_table[i].dst_ = code_buffer_[i].dst_;
+		code_table[i].src_ = code_buffer_[i].src_;
+	}
+	if (header.label_number_ > 0)
+	{
+		memcpy(image + header.label_offset_, &(label_buffer_[0]), header.label_number_ * sizeof(Label));
+	}
+	memcpy(image + header.string_offset_, &(string_offset_buffer_[0]), (header.string_number_ + 1) * sizeof(int64_t));
+	if (text_buffer_.size() > 0)
+	{
+		memcpy(image + header.text_offset_, &(text_buffer_[0]), text_buffer_.size());
+	}
+	listing_buffer_.clear();
+	code_buffer_.clear();
+	label_buffer_.clear();
+	string_offset_buffer_.clear();
+	text_buffer_.clear();
+	string_slot_table_.clear();
+	string_hash_buffer_.clear();
+	SetView(image, header.size_);
+}
+
+int64_t IrFile::SetView(const char * image, int64_t size)
+{
+	// Check the image, and return -1 if it is not a valid one.
+	const Header * header_p = (const Header *)image;
+	if (size < (int64_t)sizeof(Header) || 0 != memcmp(header_p->magic_, s_magic_, 8) || c_version_ != header_p->version_ || header_p->size_ != size)
+	{
+		return -1;
+	}
+	if (header_p->listing_number_ < 0 || header_p->code_number_ < 0 || header_p->label_number_ < 0 || header_p->string_number_ < 0)
+	{
+		return -1;
+	}
+	if (header_p->listing_offset_ < (int64_t)sizeof(Header) || header_p->listing_offset_ % 8 != 0 || header_p->listing_number_ > (size - header_p->listing_offset_) / (int64_t)sizeof(Listing))
+	{
+		return -1;
+	}
+	if (header_p->code_offset_ < (int64_t)sizeof(Header) || header_p->code_offset_ % 8 != 0 || header_p->code_number_ > (size - header_p->code_offset_) / (int64_t)sizeof(CodeItem))
+	{
+		return -1;
+	}
+	if (header_p->label_offset_ < (int64_t)sizeof(Header) || header_p->label_offset_ % 8 != 0 || header_p->label_number_ > (size - header_p->label_offset_) / (int64_t)sizeof(Label))
+	{
+		return -1;
+	}
+	if (header_p->string_offset_ < (int64_t)sizeof(Header) || header_p->string_offset_ % 8 != 0 || header_p->string_number_ >= (size - header_p->string_offset_) / (int64_t)sizeof(int64_t))
+	{
+		return -1;
+	}
+	if (header_p->text_offset_ < (int64_t)sizeof(Header) || header_p->text_offset_ > size)
+	{
+		return -1;
+	}
+	const Listing * listing_table = (const Listing *)(image + header_p->listing_offset_);
+	const CodeItem * code_table = (const CodeItem *)(image + header_p->code_offset_);
+	const Label * label_table = (const Label *)(image + header_p->label_offset_);
+	const int64_t * string_offset_table = (const int64_t *)(image + header_p->string_offset_);
+	const char * text = image + header_p->text_offset_;
+	int64_t text_size = size - header_p->text_offset_;
+	// strings: terminated by '\0', one after another
+	if (0 != string_offset_table[0] || string_offset_table[header_p->string_number_] != text_size)
+	{
+		return -1;
+	}
+	for (int64_t i = 0; i < header_p->string_number_; ++i)
+	{
+		if (string_offset_table[i + 1] <= string_offset_table[i] || string_offset_table[i + 1] > text_size || '\0' != text[string_offset_table[i + 1] - 1])
+		{
+			return -1;
+		}
+	}
+	for (int64_t i = 0; i < header_p->listing_number_; ++i)
+	{
+		if (listing_table[i].code_beginning_ < 0 || listing_table[i].code_number_ < 0 || listing_table[i].code_beginning_ > header_p->code_number_ - listing_table[i].code_number_)
+		{
+			return -1;
+		}
+	}
+	int64_t kind;
+	int64_t value;
+	for (int64_t i = 0; i < header_p->code_number_; ++i)
+	{
+		if (code_table[i].op_ >= CodeItem::c_op_number_)
+		{
+			return -1;
+		}
+		for (int64_t j = 0; j < 2; ++j)
+		{
+			kind = 0 == j ? code_table[i].dst_kind_ : code_table[i].src_kind_;
+			value = 0 == j ? code_table[i].dst_ : code_table[i].src_;
+			if (CodeItem::c_register_ == kind && (value < 0 || value >= CodeItem::c_register_number_))
+			{
+				return -1;
+			}
+			if ((CodeItem::c_variable_ == kind || CodeItem::c_label_id_ == kind || CodeItem::c_function_ == kind) && (value < 0 || value >= header_p->string_number_))
+			{
+				return -1;
+			}
+			if (CodeItem::c_word_ == kind || kind > CodeItem::c_function_)
+			{
+				return -1;
+			}
+		}
+	}
+	for (int64_t i = 0; i < header_p->label_number_; ++i)
+	{
+		if (label_table[i].string_ < 0 || label_table[i].string_ >= header_p->string_number_ || label_table[i].code_ < 0 || label_table[i].code_ >= header_p->code_number_)
+		{
+			return -1;
+		}
+	}
+	image_ = image;
+	header_ = header_p;
+	listing_table_ = listing_table;
+	code_table_ = code_table;
+	label_table_ = label_table;
+	string_offset_table_ = string_offset_table;
+	text_ = text;
+	return 1;
+}
+
+const char * IrFile::GetString(int64_t id)
+{
+	if (NULL == header_ || id < 0 || id >= header_->string_number_)
+	{
+		throw std::exception("Function \"const char * IrFile::GetString(int64_t id)\" says: Invalid parameter \"id\".");
+	}
+	return text_ + string_offset_table_[id];
+}
+
+int64_t IrFile::Save(const char * path)
+{
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t IrFile::Save(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	if (NULL == header_)
+	{
+		throw std::exception("Function \"int64_t IrFile::Save(const char * path)\" says: There is no image.");
+	}
+	FILE * fp = fopen(path, "wb");
+	if (NULL == fp)
+	{
+		return -1;
+	}
+	if (1 != fwrite(image_, header_->size_, 1, fp))
+	{
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+	return 1;
+}
+
+int64_t IrFile::ReadFile(const char * path)
+{
+	// Map the file, or read it into heap if it can not be mapped. Return -1 if it can not be read or it is empty.
+	Clear();
+	if (1 == file_.Map(path))
+	{
+		file_size_ = file_.content_size_;
+		return 1;
+	}
+	FILE * fp = fopen(path, "rb");
+	if (NULL == fp)
+	{
+		return -1;
+	}
+	std::vector<char> buffer;
+	char block[65536];
+	int64_t length;
+	while ((length = fread(block, 1, sizeof(block), fp)) > 0)
+	{
+		buffer.insert(buffer.end(), block, block + length);
+	}
+	fclose(fp);
+	if (buffer.empty())
+	{
+		return -1;
+	}
+	memcpy(file_.Malloc(buffer.size()), &(buffer[0]), buffer.size());
+	file_.content_size_ = buffer.size();
+	file_size_ = file_.content_size_;
+	return 1;
+}
+
+int64_t IrFile::Load(const char * path)
+{
+	// The image is used in place. Return -1 if the file can not be read or it is not a valid image.
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t IrFile::Load(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	if (-1 == ReadFile(path))
+	{
+		return -1;
+	}
+	return SetView(file_.content_, file_.content_size_);
+}
+
+int64_t IrFile::ReadText(const char * path)
+{
+	// Read an intermediate file written by function "WriteIntermediateFile" (or "WriteText"). Return -1 if it can not be read, with "error_line_" set if the text is invalid.
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t IrFile::ReadText(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	const char * program[5] = { "PROGRAM START", "                    CALL main", "PROGRAM END", "", "" };
+	const char * content;
+	const char * end;
+	const char * line;
+	int64_t length;
+	int64_t empty_line_number = 0;
+	bool is_listing_open = false;
+	error_line_ = -1;
+	if (-1 == ReadFile(path))
+	{
+		return -1;
+	}
+	content = file_.content_;
+	end = content + file_.content_size_;
+	// A code takes about 24 characters in the text.
+	code_buffer_.reserve(file_.content_size_ / 24);
+	for (int64_t i = 1; content < end; ++i)
+	{
+		// line (without "\r\n" or "\n")
+		line = content;
+		content = (const char *)memchr(line, '\n', end - line);
+		if (NULL == content)
+		{
+			error_line_ = i;
+			return -1;
+		}
+		length = content - line;
+		content += 1;
+		if (length > 0 && '\r' == line[length - 1])
+		{
+			length -= 1;
+		}
+		if (i <= 5)
+		{
+			if (length != strlen(program[i - 1]) || 0 != memcmp(line, program[i - 1], length))
+			{
+				error_line_ = i;
+				return -1;
+			}
+			continue;
+		}
+		// A listing ends with two empty lines, and codes are not empty.
+		if (0 == length)
+		{
+			empty_line_number += 1;
+			if (2 == empty_line_number)
+			{
+				if (false == is_listing_open)
+				{
+					AppendListing();
+				}
+				is_listing_open = false;
+				empty_line_number = 0;
+			}
+			continue;
+		}
+		if (empty_line_number > 0)
+		{
+			error_line_ = i - 1;
+			return -1;
+		}
+		if (false == is_listing_open)
+		{
+			AppendListing();
+			is_listing_open = true;
+		}
+		if (-1 == ReadCode(line, length))
+		{
+			error_line_ = i;
+			return -1;
+		}
+	}
+	if (is_listing_open || empty_line_number > 0)
+	{
+		error_line_ = 0;
+		return -1;
+	}
+	Build();
+	// The text is not used any more.
+	file_.Free();
+	return 1;
+}
+
+int64_t IrFile::ReadCode(const char * line, int64_t length)
+{
+	// "[label]:", 20 blanks (a label of no block), or 20 blanks and "[op] [dst] [src]" (an operand may be absent)
+	int64_t op = -1;
+	int64_t op_length;
+	int64_t dst_kind = CodeItem::c_none_;
+	int64_t dst = -1;
+	int64_t src_kind = CodeItem::c_none_;
+	int64_t src = -1;
+	const char * blank;
+	if (length < 20 || 0 != memcmp(line, "                    ", 20))
+	{
+		if (length < 2 || ':' != line[length - 1] || ' ' == line[0])
+		{
+			return -1;
+		}
+		if (-1 == ReadOperand(line, length - 1, false, CodeItem::c_label_, &src_kind, &src))
+		{
+			return -1;
+		}
+		AppendItem(CodeItem::c_label_, CodeItem::c_none_, -1, src_kind, src);
+		return 1;
+	}
+	line += 20;
+	length -= 20;
+	if (0 == length)
+	{
+		AppendItem(CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_none_, -1);
+		return 1;
+	}
+	for (int64_t i = 1; i < CodeItem::c_op_number_; ++i)
+	{
+		op_length = CodeItem::s_op_length_table_[i];
+		if (line[0] == CodeItem::s_op_name_table_[i][0] && length > op_length && ' ' == line[op_length] && 0 == memcmp(line, CodeItem::s_op_name_table_[i], op_length))
+		{
+			op = i;
+			break;
+		}
+	}
+	if (-1 == op)
+	{
+		return -1;
+	}
+	line += op_length + 1;
+	length -= op_length + 1;
+	// The target operand is followed by a blank.
+	blank = (const char *)memchr(line, ' ', length);
+	if (NULL != blank)
+	{
+		if (-1 == ReadOperand(line, blank - line, true, op, &dst_kind, &dst))
+		{
+			return -1;
+		}
+		length -= blank + 1 - line;
+		line = blank + 1;
+	}
+	if (length > 0)
+	{
+		if (-1 == ReadOperand(line, length, false, op, &src_kind, &src))
+		{
+			return -1;
+		}
+	}
+	AppendItem(op, dst_kind, dst, src_kind, src);
+	return 1;
+}
+
+int64_t IrFile::ReadOperand(const char * text, int64_t length, bool is_dst, int64_t op, int64_t * kind_p, int64_t * value_p)
+{
+	// The kind is known by the operation and the text: a register, an immediate, a label, a function, or a variable (any other name).
+	char buffer[32];
+	if (length <= 0 || NULL != memchr(text, ' ', length))
+	{
+		return -1;
+	}
+	for (int64_t i = 0; 'R' == text[0] && length <= 3 && i < CodeItem::c_register_number_; ++i)
+	{
+		if (length == CodeItem::s_register_length_table_[i] && 0 == memcmp(text, CodeItem::s_register_name_table_[i], length))
+		{
+			*kind_p = CodeItem::c_register_;
+			*value_p = i;
+			return 1;
+		}
+	}
+	if (is_dst)
+	{
+		*kind_p = CodeItem::c_variable_;
+	}
+	else if (CodeItem::c_label_ == op || CodeItem::c_jmp_ == op || CodeItem::c_je_ == op || CodeItem::c_jg_ == op || CodeItem::c_jl_ == op)
+	{
+		*kind_p = CodeItem::c_label_id_;
+	}
+	else if (CodeItem::c_call_ == op)
+	{
+		*kind_p = CodeItem::c_function_;
+	}
+	else
+	{
+		*kind_p = CodeItem::c_variable_;
+		if (length < sizeof(buffer))
+		{
+			memcpy(buffer, text, length);
+			buffer[length] = '\0';
+			if (1 == CodeItem::s_ParseImmediate(buffer, value_p))
+			{
+				*kind_p = CodeItem::c_immediate_;
+				return 1;
+			}
+		}
+	}
+	*value_p = AppendString(text, length);
+	return 1;
+}
+
+int64_t IrFile::WriteText(const char * path)
+{
+	// the same layout as function "WriteIntermediateFile"
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t IrFile::WriteText(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	if (NULL == header_)
+	{
+		throw std::exception("Function \"int64_t IrFile::WriteText(const char * path)\" says: There is no image.");
+	}
+	const char * program = "PROGRAM START\n                    CALL main\nPROGRAM END\n\n\n";
+	const char * blank = "                    ";
+	std::vector<char> text;
+	char buffer[32];
+	const CodeItem * code_item_p;
+	const char * operand;
+	int64_t length;
+	text.insert(text.end(), program, program + strlen(program));
+	for (int64_t i = 0; i < header_->listing_number_; ++i)
+	{
+		for (int64_t j = listing_table_[i].code_beginning_; j < listing_table_[i].code_beginning_ + listing_table_[i].code_number_; ++j)
+		{
+			code_item_p = &(code_table_[j]);
+			if (CodeItem::c_label_ != code_item_p->op_)
+			{
+				text.insert(text.end(), blank, blank + 20);
+				text.insert(text.end(), CodeItem::s_op_name_table_[code_item_p->op_], CodeItem::s_op_name_table_[code_item_p->op_] + CodeItem::s_op_length_table_[code_item_p->op_]);
+				text.push_back(' ');
+			}
+			else if (CodeItem::c_none_ == code_item_p->src_kind_)
+			{
+				text.insert(text.end(), blank, blank + 20);
+			}
+			for (int64_t k = 0; k < 2; ++k)
+			{
+				int64_t kind = 0 == k ? code_item_p->dst_kind_ : code_item_p->src_kind_;
+				int64_t value = 0 == k ? code_item_p->dst_ : code_item_p->src_;
+				if (CodeItem::c_none_ == kind)
+				{
+					continue;
+				}
+				if (CodeItem::c_register_ == kind)
+				{
+					operand = CodeItem::s_register_name_table_[value];
+					length = CodeItem::s_register_length_table_[value];
+				}
+				else if (CodeItem::c_immediate_ == kind)
+				{
+					operand = buffer;
+					length = CodeItem::s_FormatInteger(value, buffer);
+				}
+				else
+				{
+					operand = GetString(value);
+					length = string_offset_table_[value + 1] - string_offset_table_[value] - 1;
+				}
+				text.insert(text.end(), operand, operand + length);
+				if (0 == k)
+				{
+					text.push_back(' ');
+				}
+				else if (CodeItem::c_label_ == code_item_p->op_)
+				{
+					text.push_back(':');
+				}
+			}
+			text.push_back('\n');
+		}
+		text.push_back('\n');
+		text.push_back('\n');
+	}
+	FILE * fp = fopen(path, "w");
+	if (NULL == fp)
+	{
+		return -1;
+	}
+	if (1 != fwrite(&(text[0]), text.size(), 1, fp))
+	{
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+	return 1;
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef LEXICAL_TABLE_H_
+#define LEXICAL_TABLE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "token_stream.h"
+
+class LexicalTable
+{
+public:
+	// class of characters
+	static const int64_t c_class_zero_ = 0; // 0
+	static const int64_t c_class_digit_ = 1; // 1 - 9
+	static const int64_t c_class_letter_ = 2; // A - Z, a - z, _
+	static const int64_t c_class_minus_ = 3; // -
+	static const int64_t c_class_operator_ = 4; // ( ) ! * / % + < >
+	static const int64_t c_class_equal_ = 5; // =
+	static const int64_t c_class_dollar_ = 6; // $
+	static const int64_t c_class_separator_ = 7; // , ;
+	static const int64_t c_class_blank_ = 8; // space \t \r \n
+	static const int64_t c_class_left_brace_ = 9; // {
+	static const int64_t c_class_right_brace_ = 10; // }
+	static const int64_t c_class_illegal_ = 11; // others
+	static const int64_t c_class_number_ = 12;
+	// state: reading a word (less than "c_state_accept_") or accepting a word
+	static const int64_t c_state_start_ = 0; // 0
+	static const int64_t c_state_integer_ = 1; // 101
+	static const int64_t c_state_identifier_ = 2; // 201
+	static const int64_t c_state_minus_ = 3; // 301
+	static const int64_t c_state_equal_ = 4; // 302
+	static const int64_t c_state_dollar_ = 5; // 303
+	static const int64_t c_state_accept_ = 6;
+	static const int64_t c_state_accept_integer_ = 6; // 199
+	static const int64_t c_state_accept_integer_fallback_ = 7; // 198
+	static const int64_t c_state_accept_identifier_fallback_ = 8; // 299
+	static const int64_t c_state_accept_operator_ = 9; // 399
+	static const int64_t c_state_accept_operator_fallback_ = 10; // 398
+	static const int64_t c_state_accept_separator_ = 11; // 499
+	static const int64_t c_state_illegal_ = 12; // 598
+	static const int64_t c_state_number_ = 13;
+	// table
+	static unsigned char s_class_table_[256];
+	static const unsigned char s_transition_table_[c_state_accept_][c_class_number_];
+	static const int64_t s_word_type_table_[c_state_number_];
+	static const bool s_fallback_table_[c_state_number_];
+private:
+	static const char * const s_class_description_[c_class_number_];
+	static bool s_BuildClassTable();
+	static bool s_built_;
+};
+
+const char * const LexicalTable::s_class_description_[c_class_number_] =
+{
+	"0",
+	"123456789",
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_",
+	"-",
+	"()!*/%+<>",
+	"=",
+	"$",
+	";,",
+	" \t\r\n",
+	"{",
+	"}",
+	""
+};
+
+// Each row is a state of reading. The char which makes a "fallback" state is not a part of the word, and it will be read again from "c_state_start_".
+const unsigned char LexicalTable::s_transition_table_[c_state_accept_][c_class_number_] =
+{
+	// 0
+	{ c_state_accept_integer_, c_state_integer_, c_state_identifier_, c_state_minus_, c_state_accept_operator_, c_state_equal_, c_state_dollar_, c_state_accept_separator_, c_state_accept_separator_, c_state_accept_separator_, c_state_accept_separator_, c_state_illegal_ },
+	// 101
+	{ c_state_integer_, c_state_integer_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_, c_state_accept_integer_fallback_ },
+	// 201
+	{ c_state_identifier_, c_state_identifier_, c_state_identifier_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_, c_state_accept_identifier_fallback_ },
+	// 301: "-0" is 2 words.
+	{ c_state_accept_operator_fallback_, c_state_integer_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_ },
+	// 302
+	{ c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_ },
+	// 303
+	{ c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_, c_state_accept_operator_fallback_ }
+};
+
+// type of the accepted word, or -1
+const int64_t LexicalTable::s_word_type_table_[c_state_number_] =
+{
+	-1, -1, -1, -1, -1, -1,
+	TokenStream::c_constant_int_,
+	TokenStream::c_constant_int_,
+	TokenStream::c_identifier_,
+	TokenStream::c_operator_,
+	TokenStream::c_operator_,
+	TokenStream::c_separator_,
+	-1
+};
+
+const bool LexicalTable::s_fallback_table_[c_state_number_] =
+{
+	false, false, false, false, false, false,
+	false,
+	true,
+	true,
+	false,
+	true,
+	false,
+	false
+};
+
+unsigned char LexicalTable::s_class_table_[256];
+
+bool LexicalTable::s_built_ = LexicalTable::s_BuildClassTable();
+
+bool LexicalTable::s_BuildClassTable()
+{
+	// Build "s_class_table_" from "s_class_description_" before function "main".
+	for (int64_t i = 0; i < 256; ++i)
+	{
+		s_class_table_[i] = c_class_illegal_;
+	}
+	for (int64_t i = 0; i < c_class_number_; ++i)
+	{
+		for (const char * ch = s_class_description_[i]; '\0' != *ch; ++ch)
+		{
+			s_class_table_[(unsigned char)*ch] = i;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -3,14 +3,31 @@
 
 #include <stdlib.h>
 #include <vector>
+#include <chrono>
 #include <exception>
 #include "source_file.h"
 #include "error.h"
 #include "function_item.h"
 #include "annotation_item.h"
 #include "block.h"
-#include "word.h"
+#include "block_tree.h"
+#include "symbol_table.h"
+#include "token_stream.h"
+#include "interner.h"
 #include "parser_item.h"
+#include "grammar_table.h"
+#include "parser_state.h"
+#include "lexical_table.h"
+#include "scanner.h"
+#include "thread_pool.h"
+#include "preprocess_slice.h"
+#include "ir_file.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/uio.h>
+#endif
 
 //#define TEST_BLOCK_0
 //#define TEST_BLOCK_1
@@ -20,35 +37,161 @@
 //#define TEST_BLOCK_5
 //#define TEST_BLOCK_6
 //#define TEST_BLOCK_7
+//#define TEST_BLOCK_8
 
 int64_t ReadSourceFile(const char * path, SourceFile * source_file_p, Error * error_p);
-int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table);
-int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer);
+int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p);
+int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p);
+void Preprocess_Slice(SourceFile * source_file_p, const std::vector<int64_t> * structure_table_p, PreprocessSlice * slice_p);
+int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer);
+int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child);
+void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p);
 void RemoveBlankWord(bool is_block, void * pointer);
-int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p);
+int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p);
+void RemoveBlankWordInParallel(std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p);
+int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p, SymbolTable * symbol_table_p);
+int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p);
 int64_t SearchFunctionMain(Error * error_p, std::vector<FunctionItem *> * function_table_p);
-int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table);
-int64_t ParseBlock_GetSymbol(Word * word_p);
-int64_t GenerateIntermediate(std::vector<CodeItem *> * intermediate_p, char * label, char * op, char * dst, char * src);
-int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table);
+int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine);
+int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p);
+int64_t ParseBlock_Precedence(ParserState * state_p, int64_t word);
+int64_t ParseBlock_Reduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word);
+int64_t ParseBlock_Pratt(ParserState * state_p);
+int64_t ParseBlock_PrattStatement(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattRun(ParserState * state_p, int64_t * word_p, int64_t rule, int64_t power);
+void ParseBlock_PrattPush(ParserState * state_p, int64_t rule, int64_t power);
+int64_t ParseBlock_PrattExpression(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattFactor(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattParenthesis(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattOperand(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattCall(ParserState * state_p, int64_t * word_p);
+int64_t ParseBlock_PrattReduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word);
+int64_t ParseBlock_PrattSymbol(ParserState * state_p, int64_t word);
+int64_t ParseBlock_PrattExpect(ParserState * state_p, int64_t * word_p, int64_t symbol);
+int64_t ParseBlock_PrattError(ParserState * state_p, int64_t word, int64_t minor_no);
+int64_t ParseBlock_GetSymbol(TokenStream * token_stream_p, int64_t index);
+int64_t GenerateIntermediate(std::vector<CodeItem> * intermediate_p, int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src);
+int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p);
+void WriteIntermediateFile_Format(std::vector<char> * text_p, std::vector<CodeItem> * intermediate_p, Block * block_p, SymbolTable * symbol_table_p);
+const char * WriteIntermediateFile_GetText(CodeItem * code_item_p, bool is_dst, Block * block_p, SymbolTable * symbol_table_p, std::vector<char> * buffer_p, int64_t * length_p);
+int64_t WriteIntermediateFile_Output(char * path, std::vector<std::vector<char> > * text_table_p);
+int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p);
+int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p);
 
 int main(int argc, char ** argv)
 {
 	char input_path[1024];
 	char output_path[1024];
+	// option: "-e pratt" or "-e precedence" selects the engine of parsing blocks (see "parser_state.h").
+	int64_t engine = ParserState::c_precedence_engine_;
+	// option: "-b [path]" writes the binary intermediate file too, and "-c" converts an intermediate file between text and binary (see "ir_file.h").
+	char * image_path = NULL;
+	bool convert = false;
+	// option: "-j [number]" sets the number of threads (the number of cores by default).
+	int64_t thread_number = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	// option: "-t" shows the time of steps, and "-s [scalar, sse2 or avx2]" selects the SIMD of searching (see "scanner.h"), to compare them.
+	bool timing = false;
+	double second;
+	std::chrono::steady_clock::time_point beginning;
+	int64_t line;
+	char * path_table[2];
+	int64_t path_number = 0;
 	SourceFile source_file;
 	Error error;
 	std::vector<FunctionItem *> function_table;
-	std::vector<Block *> block_table;
+	BlockTree block_tree;
+	SymbolTable symbol_table(&block_tree);
+	ThreadPool thread_pool;
 	printf("\n");
-	if (argc == 3)
+	for (int64_t i = 1; i < argc; ++i)
+	{
+		if (0 == strcmp(argv[i], "-e") && i + 1 < argc)
+		{
+			i += 1;
+			if (0 == strcmp(argv[i], "pratt"))
+			{
+				engine = ParserState::c_pratt_engine_;
+			}
+			else if (0 == strcmp(argv[i], "precedence"))
+			{
+				engine = ParserState::c_precedence_engine_;
+			}
+			else
+			{
+				printf("Unknown engine \"%s\" (\"pratt\" or \"precedence\").\n", argv[i]);
+				printf("\n");
+				printf("Fail.\n");
+				printf("\n");
+				system("PAUSE");
+				return 0;
+			}
+		}
+		else if (0 == strcmp(argv[i], "-b") && i + 1 < argc)
+		{
+			i += 1;
+			image_path = argv[i];
+		}
+		else if (0 == strcmp(argv[i], "-c"))
+		{
+			convert = true;
+		}
+		else if (0 == strcmp(argv[i], "-j") && i + 1 < argc)
+		{
+			i += 1;
+			thread_number = atoi(argv[i]);
+			if (thread_number <= 0)
+			{
+				printf("Invalid number of threads \"%s\".\n", argv[i]);
+				printf("\n");
+				printf("Fail.\n");
+				printf("\n");
+				system("PAUSE");
+				return 0;
+			}
+		}
+		else if (0 == strcmp(argv[i], "-t"))
+		{
+			timing = true;
+		}
+		else if (0 == strcmp(argv[i], "-s") && i + 1 < argc)
+		{
+			i += 1;
+			if (0 == strcmp(argv[i], "scalar"))
+			{
+				Scanner::s_simd_ = Scanner::c_simd_scalar_;
+			}
+			else if (0 == strcmp(argv[i], "sse2") && Scanner::s_GetBestSimd() >= Scanner::c_simd_sse2_)
+			{
+				Scanner::s_simd_ = Scanner::c_simd_sse2_;
+			}
+			else if (0 == strcmp(argv[i], "avx2") && Scanner::s_GetBestSimd() >= Scanner::c_simd_avx2_)
+			{
+				Scanner::s_simd_ = Scanner::c_simd_avx2_;
+			}
+			else
+			{
+				printf("Unknown or not built SIMD \"%s\" (\"scalar\", \"sse2\" or \"avx2\").\n", argv[i]);
+				printf("\n");
+				printf("Fail.\n");
+				printf("\n");
+				system("PAUSE");
+				return 0;
+			}
+		}
+		else if (path_number < 2)
+		{
+			path_table[path_number] = argv[i];
+			path_number += 1;
+		}
+	}
+	if (path_number == 2)
 	{
-		strcpy(input_path, argv[1]);
-		strcpy(output_path, argv[2]);
+		strcpy(input_path, path_table[0]);
+		strcpy(output_path, path_table[1]);
 	}
-	else if (argc == 2)
+	else if (path_number == 1)
 	{
-		strcpy(input_path, argv[1]);
+		strcpy(input_path, path_table[0]);
 #ifdef TEST_BLOCK_0
 		// test file
 		strcpy(output_path, "example.i.test");
@@ -73,6 +216,38 @@ int main(int argc, char ** argv)
 		printf("\n");
 #endif
 	}
+	if (convert)
+	{
+		printf("Converting intermediate file ...\n");
+		printf("\n");
+		if (-1 == ConvertIntermediateFile(input_path, output_path, &error, &line))
+		{
+			printf("%s\n", error.GetErrorString(&source_file));
+			if (line > 0)
+			{
+				printf("Line: %I64d\n", line);
+			}
+			printf("\n");
+			printf("Fail.\n");
+			printf("\n");
+			system("PAUSE");
+			return 0;
+		}
+		printf("Complete.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
+	}
+	if (false == GrammarTable::s_built_)
+	{
+		printf("There is a conflict in \"GrammarTable::s_relation_description_\" or \"GrammarTable::s_right_table_\".\n");
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
+	}
+	thread_pool.Start(thread_number);
 	printf("Reading source file ...\n");
 	printf("\n");
 	if (-1 == ReadSourceFile(input_path, &source_file, &error))
@@ -86,7 +261,8 @@ int main(int argc, char ** argv)
 	}
 	printf("Preprocessing ...\n");
 	printf("\n");
-	if (-1 == Preprocess(&source_file, &error, &function_table, &block_table))
+	beginning = std::chrono::steady_clock::now();
+	if (-1 == Preprocess(&source_file, &error, &function_table, &block_tree, &thread_pool))
 	{
 		printf("%s\n", error.GetErrorString(&source_file));
 		printf("\n");
@@ -95,6 +271,12 @@ int main(int argc, char ** argv)
 		system("PAUSE");
 		return 0;
 	}
+	if (timing)
+	{
+		second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+		printf("Preprocess: %I64d bytes in %.6f s (%.1f MB/s).\n", source_file.content_size_, second, second > 0 ? source_file.content_size_ / second / 1000000 : 0.0);
+		printf("\n");
+	}
 #ifdef TEST_BLOCK_1
 	// test block #1
 	{
@@ -102,6 +284,7 @@ int main(int argc, char ** argv)
 		int64_t counter = 0;
 		do
 		{
+			source_file.LocateLine();
 			printf("{\ncontent:    [% 6I64d] %c\nline:       [% 6I64d] %I64d\nannotation: [% 6I64d] %s\n}\n", source_file.index_, source_file.content_[source_file.index_], source_file.line_index_, source_file.line_, source_file.annotation_index_, source_file.annotation_ ? "true" : "false");
 			counter += 1;
 			if (counter % 50 == 0)
@@ -115,60 +298,39 @@ int main(int argc, char ** argv)
 #endif
 	printf("Lexical Analysing ...\n");
 	printf("\n");
-	for (int64_t i = 0; i < function_table.size(); ++i)
-	{
-		if (-1 == LexicalAnalyse(&source_file, &error, &block_table, false, function_table[i]))
-		{
-			printf("%s\n", error.GetErrorString(&source_file));
-			printf("\n");
-			printf("Fail.\n");
-			printf("\n");
-			system("PAUSE");
-			return 0;
-		}
-	}
-	for (int64_t i = 0; i < block_table.size(); ++i)
+	if (-1 == LexicalAnalyseInParallel(&source_file, &error, &function_table, &block_tree, &thread_pool))
 	{
-		if (-1 == LexicalAnalyse(&source_file, &error, &block_table, true, block_table[i]))
-		{
-			printf("%s\n", error.GetErrorString(&source_file));
-			printf("\n");
-			printf("Fail.\n");
-			printf("\n");
-			system("PAUSE");
-			return 0;
-		}
+		printf("%s\n", error.GetErrorString(&source_file));
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
 	}
 #ifdef TEST_BLOCK_2
 	// test block #2
 	{
 		printf("----------  test block #2: BEGIN ----------\n\n");
-		Word * word;
-		for (int64_t i = 0; i < block_table.size(); ++i)
+		TokenStream * token_stream_p;
+		char text[TokenStream::c_text_size_];
+		char name[Block::c_name_size_];
+		for (int64_t i = 0; i < block_tree.size_; ++i)
 		{
-			word = &(block_table[i]->word_header);
-			printf("# %s: BEGIN #\n", block_table[i]->name_);
-			while (word != NULL)
+			token_stream_p = &(block_tree.block_table_[i]->token_stream);
+			printf("# %s: BEGIN #\n", Block::s_GetName(i, name));
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
-				if (word->content_)
-				{
-					printf("%s", word->content_);
-				}
-				word = word->next_;
+				printf("%s", token_stream_p->CopyText(j, text));
 			}
-			printf("\n# %s: END #\n\n", block_table[i]->name_);
+			printf("\n# %s: END #\n\n", Block::s_GetName(i, name));
 		}
 		for (int64_t i = 0; i < function_table.size(); ++i)
 		{
-			word = &(function_table[i]->word_header);
+			token_stream_p = &(function_table[i]->token_stream);
 			printf("# function head %I64d: BEGIN #\n", i);
-			while (word != NULL)
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
-				if (word->content_)
-				{
-					printf("%s", word->content_);
-				}
-				word = word->next_;
+				printf("%s", token_stream_p->CopyText(j, text));
 			}
 			printf("\n# function head %I64d: BEGIN #\n\n", i);
 		}
@@ -180,55 +342,51 @@ int main(int argc, char ** argv)
 	// test block #3
 	{
 		printf("----------  test block #3: BEGIN ----------\n\n");
-		Word * word;
+		TokenStream * token_stream_p;
+		char text[TokenStream::c_text_size_];
+		char name[Block::c_name_size_];
 		int64_t counter = 0;
 		for (int64_t i = 0; i < function_table.size(); ++i)
 		{
-			word = &(function_table[i]->word_header);
+			token_stream_p = &(function_table[i]->token_stream);
 			printf("# function: BEGIN #\n");
-			while (word != NULL)
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
 				printf("{\n");
-				if (word->content_)
-				{
-					printf("\tcontent:           %s\n", word->content_);
-				}
-				printf("\ttype:              %I64d\n", word->type_);
-				printf("\tsource_file_index: %I64d\n", word->source_file_index_);
+				printf("\tcontent:           %s\n", token_stream_p->CopyText(j, text));
+				printf("\ttype:              %I64d\n", (int64_t)token_stream_p->type_table_[j]);
+				printf("\tsymbol:            %I64d\n", (int64_t)token_stream_p->symbol_table_[j]);
+				printf("\tsource_file_index: %I64d\n", token_stream_p->location_table_[j]);
 				printf("}\n");
 				counter += 1;
 				if (counter % 50 == 0)
 				{
 					system("PAUSE");
 				}
-				word = word->next_;
 			}
 			printf("\n# function: END #\n\n");
 			system("PAUSE");
 			counter = 0;
 		}
-		for (int64_t i = 0; i < block_table.size(); ++i)
+		for (int64_t i = 0; i < block_tree.size_; ++i)
 		{
-			word = &(block_table[i]->word_header);
-			printf("# %s: BEGIN #\n", block_table[i]->name_);
-			while (word != NULL)
+			token_stream_p = &(block_tree.block_table_[i]->token_stream);
+			printf("# %s: BEGIN #\n", Block::s_GetName(i, name));
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
 				printf("{\n");
-				if (word->content_)
-				{
-					printf("\tcontent:           %s\n", word->content_);
-				}
-				printf("\ttype:              %I64d\n", word->type_);
-				printf("\tsource_file_index: %I64d\n", word->source_file_index_);
+				printf("\tcontent:           %s\n", token_stream_p->CopyText(j, text));
+				printf("\ttype:              %I64d\n", (int64_t)token_stream_p->type_table_[j]);
+				printf("\tsymbol:            %I64d\n", (int64_t)token_stream_p->symbol_table_[j]);
+				printf("\tsource_file_index: %I64d\n", token_stream_p->location_table_[j]);
 				printf("}\n");
 				counter += 1;
 				if (counter % 50 == 0)
 				{
 					system("PAUSE");
 				}
-				word = word->next_;
 			}
-			printf("\n# %s: END #\n\n", block_table[i]->name_);
+			printf("\n# %s: END #\n\n", Block::s_GetName(i, name));
 			system("PAUSE");
 			counter = 0;
 		}
@@ -238,67 +396,56 @@ int main(int argc, char ** argv)
 #endif
 	printf("Removing blank word ...\n");
 	printf("\n");
-	for (int64_t i = 0; i < function_table.size(); ++i)
-	{
-		RemoveBlankWord(false, function_table[i]);
-	}
-	for (int64_t i = 0; i < block_table.size(); ++i)
-	{
-		RemoveBlankWord(true, block_table[i]);
-	}
+	RemoveBlankWordInParallel(&function_table, &block_tree, &thread_pool);
 #ifdef TEST_BLOCK_4
 	// test block #4
 	{
 		printf("----------  test block #4: BEGIN ----------\n\n");
-		Word * word;
+		TokenStream * token_stream_p;
+		char text[TokenStream::c_text_size_];
+		char name[Block::c_name_size_];
 		int64_t counter = 0;
 		for (int64_t i = 0; i < function_table.size(); ++i)
 		{
-			word = &(function_table[i]->word_header);
+			token_stream_p = &(function_table[i]->token_stream);
 			printf("# function: BEGIN #\n");
-			while (word != NULL)
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
 				printf("{\n");
-				if (word->content_)
-				{
-					printf("\tcontent:           %s\n", word->content_);
-				}
-				printf("\ttype:              %I64d\n", word->type_);
-				printf("\tsource_file_index: %I64d\n", word->source_file_index_);
+				printf("\tcontent:           %s\n", token_stream_p->CopyText(j, text));
+				printf("\ttype:              %I64d\n", (int64_t)token_stream_p->type_table_[j]);
+				printf("\tsymbol:            %I64d\n", (int64_t)token_stream_p->symbol_table_[j]);
+				printf("\tsource_file_index: %I64d\n", token_stream_p->location_table_[j]);
 				printf("}\n");
 				counter += 1;
 				if (counter % 50 == 0)
 				{
 					system("PAUSE");
 				}
-				word = word->next_;
 			}
 			printf("\n# function: END #\n\n");
 			system("PAUSE");
 			counter = 0;
 		}
-		for (int64_t i = 0; i < block_table.size(); ++i)
+		for (int64_t i = 0; i < block_tree.size_; ++i)
 		{
-			word = &(block_table[i]->word_header);
-			printf("# %s: BEGIN #\n", block_table[i]->name_);
-			while (word != NULL)
+			token_stream_p = &(block_tree.block_table_[i]->token_stream);
+			printf("# %s: BEGIN #\n", Block::s_GetName(i, name));
+			for (int64_t j = 0; j < token_stream_p->size_; ++j)
 			{
 				printf("{\n");
-				if (word->content_)
-				{
-					printf("\tcontent:           %s\n", word->content_);
-				}
-				printf("\ttype:              %I64d\n", word->type_);
-				printf("\tsource_file_index: %I64d\n", word->source_file_index_);
+				printf("\tcontent:           %s\n", token_stream_p->CopyText(j, text));
+				printf("\ttype:              %I64d\n", (int64_t)token_stream_p->type_table_[j]);
+				printf("\tsymbol:            %I64d\n", (int64_t)token_stream_p->symbol_table_[j]);
+				printf("\tsource_file_index: %I64d\n", token_stream_p->location_table_[j]);
 				printf("}\n");
 				counter += 1;
 				if (counter % 50 == 0)
 				{
 					system("PAUSE");
 				}
-				word = word->next_;
 			}
-			printf("\n# %s: END #\n\n", block_table[i]->name_);
+			printf("\n# %s: END #\n\n", Block::s_GetName(i, name));
 			system("PAUSE");
 			counter = 0;
 		}
@@ -308,17 +455,14 @@ int main(int argc, char ** argv)
 #endif
 	printf("Parsing ...\n");
 	printf("\n");
-	for (int64_t i = 0; i < function_table.size(); ++i)
+	if (-1 == ParseFunctionHeadInParallel(&source_file, &error, &function_table, &symbol_table, &thread_pool))
 	{
-		if (-1 == ParseFunctionHead(&source_file, &error, function_table[i]))
-		{
-			printf("%s\n", error.GetErrorString(&source_file));
-			printf("\n");
-			printf("Fail.\n");
-			printf("\n");
-			system("PAUSE");
-			return 0;
-		}
+		printf("%s\n", error.GetErrorString(&source_file));
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
 	}
 	if (-1 == SearchFunctionMain(&error, &function_table))
 	{
@@ -350,21 +494,26 @@ int main(int argc, char ** argv)
 		system("PAUSE");
 	}
 #endif
-	for (int64_t i = 0; i < block_table.size(); ++i)
+	beginning = std::chrono::steady_clock::now();
+	if (-1 == ParseBlockInParallel(&source_file, &error, &function_table, &block_tree, &symbol_table, engine, &thread_pool))
 	{
-		if (-1 == ParseBlock(&source_file, &error, block_table[i], &function_table, &block_table))
-		{
-			printf("%s\n", error.GetErrorString(&source_file));
-			printf("\n");
-			printf("Fail.\n");
-			printf("\n");
-			system("PAUSE");
-			return 0;
-		}
+		printf("%s\n", error.GetErrorString(&source_file));
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
+	}
+	if (timing)
+	{
+		second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+		printf("Parse blocks: %I64d blocks in %.6f s.\n", (int64_t)block_tree.block_table_.size(), second);
+		printf("\n");
 	}
 	printf("Writing intermediate file ...\n");
 	printf("\n");
-	if (-1 == WriteIntermediateFile(output_path, &error, &function_table, &block_table))
+	beginning = std::chrono::steady_clock::now();
+	if (-1 == WriteIntermediateFile(output_path, &error, &function_table, &(block_tree.block_table_), &symbol_table, &thread_pool))
 	{
 		printf("%s\n", error.GetErrorString(&source_file));
 		printf("\n");
@@ -373,13 +522,47 @@ int main(int argc, char ** argv)
 		system("PAUSE");
 		return 0;
 	}
+	if (timing)
+	{
+		// The size of the file is not known here (line feeds may be written as "\r\n"), so the caller divides it by the time.
+		second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+		printf("Write intermediate file: %.6f s.\n", second);
+		printf("\n");
+	}
+	if (NULL != image_path)
+	{
+		printf("Writing binary intermediate file ...\n");
+		printf("\n");
+		if (-1 == WriteIntermediateImage(image_path, &error, &function_table, &(block_tree.block_table_), &symbol_table))
+		{
+			printf("%s\n", error.GetErrorString(&source_file));
+			printf("\n");
+			printf("Fail.\n");
+			printf("\n");
+			system("PAUSE");
+			return 0;
+		}
+	}
 	// reclaim memory
 	for (int64_t i = 0; i < function_table.size(); ++i)
 	{
 		FunctionItem::s_Free(function_table[i]);
 		function_table[i] = NULL;
 	}
-	// Do not reclaim memory in "block_table"! They have been reclaimed already.
+	symbol_table.Clear();
+	block_tree.Clear();
+#ifdef TEST_BLOCK_8
+	// test block #8: Codes and variables are in arenas, which should all be released now.
+	{
+		printf("----------  test block #8: BEGIN ----------\n\n");
+		printf("allocation in arenas: %I64d\n", (int64_t)Arena::s_allocation_number_);
+		printf("peak bytes of arenas: %I64d\n", (int64_t)Arena::s_peak_byte_number_);
+		printf("bytes not released:   %I64d\n", (int64_t)Arena::s_byte_number_);
+		printf("%s\n\n", 0 == Arena::s_byte_number_ ? "All arenas are released." : "Some arenas are not released!");
+		printf("----------  test block #8: END ----------\n\n");
+		system("PAUSE");
+	}
+#endif
 	printf("Complete.\n");
 	printf("\n");
 	system("PAUSE");
@@ -401,73 +584,91 @@ int64_t ReadSourceFile(const char * path, SourceFile * source_file_p, Error * er
 		throw std::exception("Function \"int64_t ReadSourceFile(const char * path, SourceFile * source_file_p, Error * error_p)\" says: Invalid parameter \"error_p\".");
 	}
 	FILE * fp = NULL;
+	std::vector<char> buffer;
+	char * content;
+	// map file: "content_" will be a read-only view of the file without copying
+	if (1 == source_file_p->Map(path))
+	{
+		return 1;
+	}
+	// The file could not be mapped (pipe, etc.). Read it into heap instead.
 	// open file
-	fp = fopen(path, "r");
+	fp = fopen(path, "rb");
 	if (NULL == fp)
 	{
 		error_p->major_no_ = 0;
 		error_p->minor_no_ = 0;
 		return -1;
 	}
+	// read file: The size of a pipe is unknown, so read it until EOF.
+	for (int64_t offset = 0, length = 0; false == feof(fp);)
+	{
+		buffer.resize(offset + 65536);
+		length = fread(&(buffer[offset]), 1, 65536, fp);
+		if (ferror(fp))
+		{
+			error_p->major_no_ = 0;
+			error_p->minor_no_ = 3;
+			fclose(fp);
+			return -1;
+		}
+		offset += length;
+		buffer.resize(offset);
+	}
+	// close file
+	fclose(fp);
+	fp = NULL;
 	// get file size
-	fseek(fp, 0, SEEK_END);
-	source_file_p->content_size_ = ftell(fp);
+	source_file_p->content_size_ = buffer.size();
 	if (0 == source_file_p->content_size_)
 	{
 		error_p->major_no_ = 0;
 		error_p->minor_no_ = 1;
 		return -1;
 	}
-	fseek(fp, 0, SEEK_SET);
 	// malloc
-	source_file_p->Malloc(source_file_p->content_size_ + 1);
-	if (NULL == source_file_p->content_)
+	content = (char *)source_file_p->Malloc(source_file_p->content_size_ + 1);
+	if (NULL == content)
 	{
 		error_p->major_no_ = 0;
 		error_p->minor_no_ = 2;
 		return -1;
 	}
-	source_file_p->content_[source_file_p->content_size_] = '\0';
-	// read file
-	for (int64_t offset = 0, length = 0, remain = source_file_p->content_size_; remain > 0;)
-	{
-		length = fread(source_file_p->content_ + offset, 1, remain, fp);
-		if (feof(fp))
-		{
-			break;
-		}
-		if (length <= 0)
-		{
-			error_p->major_no_ = 0;
-			error_p->minor_no_ = 3;
-			return -1;
-		}
-		offset += length;
-		remain -= length;
-	}
-	// close file
-	fclose(fp);
-	fp = NULL;
+	memcpy(content, &(buffer[0]), source_file_p->content_size_);
+	content[source_file_p->content_size_] = '\0';
 	return 1;
 }
 
-int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)
+int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)
 {
 	if (NULL == source_file_p)
 	{
-		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"source_file_p\".");
+		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"source_file_p\".");
 	}
 	if (NULL == error_p)
 	{
-		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"error_p\".");
+		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
 	}
 	if (NULL == function_table_p)
 	{
-		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"function_table_p\".");
+		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
 	}
-	if (NULL == block_table)
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	// A large source file is preprocessed in parallel. If it is wrong, nothing is filled in, and the serial traversal finds the error as with one thread.
+	if (thread_pool_p->thread_number_ > 1 && source_file_p->content_size_ >= 2 * Scanner::c_chunk_size_)
 	{
-		throw std::exception("Function \"int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"block_table\".");
+		int64_t result = Preprocess_Parallel(source_file_p, error_p, function_table_p, block_tree_p, thread_pool_p);
+		if (0 != result)
+		{
+			return result;
+		}
 	}
 	// pointer
 	FunctionItem * function_item_pointer = NULL;
@@ -476,10 +677,9 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 	std::vector<char> annotation;
 	// pointer
 	AnnotationItem * annotation_item_pointer = NULL;
-	// block
-	Block * block_root;
-	Block * block_p;
-	Block * block_next_p;
+	// block: index in the block tree (There is no block out of functions.)
+	int64_t block = BlockTree::c_none_;
+	int64_t block_next;
 	// line: The first line must be at the beginning of the source file.
 	source_file_p->line_table_.push_back(0);
 	// function: The first function must be at the beginning of the source file. If not, there must be an function format error. This type of error will be checked out behind.
@@ -492,13 +692,15 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 		return -1;
 	}
 	(*function_table_p)[function_table_p->size() - 1]->beginning_ = 0;
-	// block
-	block_root = new Block();
-	block_p = block_root;
-	block_next_p = block_p->child_;
 	// traverse
 	for (source_file_p->index_ = 0; source_file_p->index_ < source_file_p->content_size_; ++source_file_p->index_)
 	{
+		// skip ordinary characters: only structural characters matter
+		source_file_p->index_ = Scanner::s_SearchStructure(source_file_p->content_, source_file_p->index_, source_file_p->content_size_);
+		if (source_file_p->index_ >= source_file_p->content_size_)
+		{
+			break;
+		}
 		switch (source_file_p->content_[source_file_p->index_])
 		{
 			// line feed
@@ -552,8 +754,6 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 				{
 					error_p->major_no_ = 1;
 					error_p->minor_no_ = 2;
-					// free
-					Block::s_FreeAll(block_root);
 					return -1;
 				}
 				source_file_p->annotation_table_[source_file_p->annotation_table_.size() - 1]->beginning_ = source_file_p->index_;
@@ -586,27 +786,15 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 			}
 			brace.push_back('{');
 			// block
-			block_next_p = block_p->AddChild();
-			// block pointer table
-			block_table->push_back(block_next_p);
-			if (NULL == block_next_p)
-			{
-				error_p->major_no_ = 1;
-				error_p->minor_no_ = 2;
-				// free
-				Block::s_FreeAll(block_root);
-				return -1;
-			}
-			if (-1 == block_next_p->SetName())
+			block_next = block_tree_p->Append(block);
+			if (BlockTree::c_none_ == block_next)
 			{
 				error_p->major_no_ = 1;
 				error_p->minor_no_ = 2;
-				// free
-				Block::s_FreeAll(block_root);
 				return -1;
 			}
-			block_next_p->beginning_ = source_file_p->index_;
-			block_p = block_next_p;
+			block_tree_p->beginning_table_[block_next] = source_file_p->index_;
+			block = block_next;
 			break;
 		case '}':
 			if (source_file_p->annotation_)
@@ -617,37 +805,36 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 			{
 				error_p->major_no_ = 1;
 				error_p->minor_no_ = 1;
-				// free
-				Block::s_FreeAll(block_root);
 				return -1;
 			}
 			brace.pop_back();
 			// block
-			block_p->end_ = source_file_p->index_;
-			block_p = block_p->parent_;
+			block_tree_p->SetEnd(block, source_file_p->index_);
 			if (brace.empty())
 			{
 				// Character '}' in the first level means that a function comes to an end.
-				// function
+				// function: link it with its block
 				(*function_table_p)[function_table_p->size() - 1]->end_ = source_file_p->index_;
+				(*function_table_p)[function_table_p->size() - 1]->block_tree = block_tree_p->block_table_[block];
+				block_tree_p->block_table_[block]->function_ = (*function_table_p)[function_table_p->size() - 1];
 				function_table_p->push_back(function_item_pointer);
 				(*function_table_p)[function_table_p->size() - 1] = FunctionItem::s_Malloc();
 				if (NULL == (*function_table_p)[function_table_p->size() - 1])
 				{
 					error_p->major_no_ = 1;
 					error_p->minor_no_ = 2;
-					// free
-					Block::s_FreeAll(block_root);
 					return -1;
 				}
 				(*function_table_p)[function_table_p->size() - 1]->beginning_ = source_file_p->index_ + 1;
 			}
+			block = block_tree_p->parent_table_[block];
 			break;
 		default:
 			break;
 		}
 	}
 	// function: Remove the final item in function table because it must be incorrect.
+	FunctionItem::s_Free((*function_table_p)[function_table_p->size() - 1]);
 	function_table_p->pop_back();
 	// size
 	source_file_p->line_size_ = source_file_p->line_table_.size();
@@ -657,8 +844,6 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 	{
 		error_p->major_no_ = 1;
 		error_p->minor_no_ = 1;
-		// free
-		Block::s_FreeAll(block_root);
 		return -1;
 	}
 	if (false == annotation.empty())
@@ -667,622 +852,964 @@ int64_t Preprocess(SourceFile * source_file_p, Error * error_p, std::vector<Func
 		error_p->minor_no_ = 0;
 		return -1;
 	}
-	// link functions with blocks
-	for (block_p = block_root->child_; block_p != NULL; block_p = block_p->brother_)
-	{
-		for (int64_t i = 0; i < function_table_p->size(); ++i)
-		{
-			if (block_p->end_ == (*function_table_p)[i]->end_)
-			{
-				block_p->function_ = (*function_table_p)[i];
-				(*function_table_p)[i]->block_tree = block_p;
-				break;
-			}
-		}
-	}
-	// unlink function-blocks from block-root
-	for (int64_t i = 0; i < function_table_p->size(); ++i)
-	{
-		(*function_table_p)[i]->block_tree->parent_ = NULL;
-		(*function_table_p)[i]->block_tree->brother_ = NULL;
-	}
-	// delete block-root
-	delete block_root;
-	block_root = NULL;
 	// get ready
 	source_file_p->ReadyToMove();
 	return 1;
 }
 
-int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)
+int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)
 {
+	// Preprocess a large source file in parallel, into the same tables as the serial traversal.
+	// The structural characters are split into slices, and each slice is traversed on its own, with depths and numbers local to it. A prefix pass over the slices gives their depths at the beginning and their offsets, then the slices are copied into their places in parallel.
+	// Return 1, or -1 if out of memory, or 0 if braces or annotation tags do not match (Nothing is filled in then.).
 	if (NULL == source_file_p)
 	{
-		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\" says: Invalid parameter \"source_file_p\".");
+		throw std::exception("Function \"int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"source_file_p\".");
 	}
 	if (NULL == error_p)
 	{
-		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\" says: Invalid parameter \"error_p\".");
+		throw std::exception("Function \"int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
 	}
-	if (NULL == block_pointer_table_p)
+	if (NULL == function_table_p)
 	{
-		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\" says: Invalid parameter \"block_pointer_table_p\".");
+		throw std::exception("Function \"int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
 	}
-	if (NULL == block_pointer_table_p)
+	if (NULL == block_tree_p)
 	{
-		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\" says: Invalid parameter \"pointer\".");
+		throw std::exception("Function \"int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_tree_p\".");
 	}
-	FunctionItem * function_item_p;
-	Block * block_p;
-	Word * word_previous_p;
-	Word * word_p;
-	int64_t end;
-	int64_t block_level;
-	if (is_block)
+	if (NULL == thread_pool_p)
 	{
-		// block
-		block_p = (Block *)pointer;
-		function_item_p = NULL;
-		word_previous_p = block_p->word_header.previous_;
-		word_p = &(block_p->word_header);
-		source_file_p->JumpTo(block_p->beginning_);
-		end = block_p->end_;
-		block_level = 0;
+		throw std::exception("Function \"int64_t Preprocess_Parallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
 	}
-	else
+	const char * content = source_file_p->content_;
+	int64_t size = source_file_p->content_size_;
+	// step 1: structural characters, split into slices of the same number of them
+	std::vector<int64_t> structure_table;
+	Scanner::s_SearchStructureParallel(content, size, thread_pool_p, &structure_table);
+	int64_t structure_size = structure_table.size();
+	int64_t slice_number = thread_pool_p->thread_number_ * 4;
+	if (slice_number > structure_size)
 	{
-		// function (head)
-		block_p = NULL;
-		function_item_p = (FunctionItem *)pointer;
-		word_previous_p = function_item_p->word_header.previous_;
-		word_p = &(function_item_p->word_header);
-		source_file_p->JumpTo(function_item_p->beginning_);
-		end = function_item_p->end_;
-		block_level = 1;
+		slice_number = structure_size;
 	}
-	int64_t status = 0;
-	char ch = source_file_p->content_[source_file_p->index_];
-	while (source_file_p->index_ <= end)
+	if (slice_number < 1)
 	{
-		// annotation
-		if (source_file_p->annotation_)
-		{
-			// move to the next char
-			source_file_p->MoveNext();
-			// get a char
-			ch = source_file_p->content_[source_file_p->index_];
-			continue;
-		}
-		switch (status)
+		slice_number = 1;
+	}
+	std::vector<PreprocessSlice> slice_table(slice_number);
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		slice_table[i].beginning_ = structure_size * i / slice_number;
+		slice_table[i].end_ = structure_size * (i + 1) / slice_number;
+	}
+	// step 2: the last annotation tag of each slice (searched backward), and then whether each slice begins in an annotation
+	thread_pool_p->ParallelFor(slice_number, [&](int64_t i)
+	{
+		int64_t index;
+		for (int64_t j = slice_table[i].end_ - 1; j >= slice_table[i].beginning_; --j)
 		{
-		case 0:
-			if (ch >= '0' && ch <= '9')
+			index = structure_table[j];
+			if (index < size - 1)
 			{
-				if ('0' == ch)
+				if ('/' == content[index] && '*' == content[index + 1])
 				{
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 199;
-				}
-				else
-				{
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 101;
+					slice_table[i].last_tag_ = PreprocessSlice::c_tag_beginning_;
+					break;
 				}
-			}
-			else if ((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || '_' == ch)
-			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 201;
-			}
-			else
-			{
-				switch (ch)
+				if ('*' == content[index] && '/' == content[index + 1])
 				{
-				case '-':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 301;
-					break;
-				case '(':
-				case ')':
-				case '!':
-				case '*':
-				case '/':
-				case '%':
-				case '+':
-				case '<':
-				case '>':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 399;
-					break;
-				case '=':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 302;
-					break;
-				case '$':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 303;
-					break;
-				case ' ':
-				case '\t':
-				case '\r':
-				case '\n':
-				case ';':
-				case ',':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 499;
-					break;
-				case '{':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 499;
-					// ignore child block (+)
-					block_level += 1;
-					if (block_level >= 2)
-					{
-						// search and jump index
-						for (int64_t i = 0; i < block_pointer_table_p->size(); ++i)
-						{
-							if ((*block_pointer_table_p)[i]->beginning_ == source_file_p->index_)
-							{
-								source_file_p->JumpTo((*block_pointer_table_p)[i]->end_ - 1);
-								break;
-							}
-						}
-					}
-					break;
-				case '}':
-					// read a char
-					Word::s_buffer_[Word::s_buffer_index_] = ch;
-					Word::s_MoveBufferIndex(true, 1);
-					// set status
-					status = 499;
-					// ignore child block (-)
-					block_level -= 1;
-					break;
-				default:
-					// set status (error)
-					status = 598;
+					slice_table[i].last_tag_ = PreprocessSlice::c_tag_end_;
 					break;
 				}
 			}
-			break;
-		case 101:
-			if (ch >= '0' && ch <= '9')
-			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 101;
+		}
+	});
+	bool annotation = false;
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		slice_table[i].annotation_ = annotation;
+		if (PreprocessSlice::c_tag_beginning_ == slice_table[i].last_tag_)
+		{
+			annotation = true;
+		}
+		else if (PreprocessSlice::c_tag_end_ == slice_table[i].last_tag_)
+		{
+			annotation = false;
+		}
+	}
+	// step 3: traverse each slice
+	thread_pool_p->ParallelFor(slice_number, [&](int64_t i)
+	{
+		Preprocess_Slice(source_file_p, &structure_table, &(slice_table[i]));
+	});
+	// step 4: prefix pass: depths at the beginning of each slice, and offsets. A depth below 0, or not 0 at the end, means the source file is wrong.
+	int64_t annotation_depth = 0;
+	int64_t brace_depth = 0;
+	int64_t line_size = 1;
+	int64_t annotation_size = 0;
+	int64_t block_size = 0;
+	int64_t close_size = 0;
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		PreprocessSlice * slice_p = &(slice_table[i]);
+		if (annotation_depth + slice_p->annotation_minimum_ < 0 || brace_depth + slice_p->brace_minimum_ < 0)
+		{
+			return 0;
+		}
+		slice_p->annotation_depth_beginning_ = annotation_depth;
+		slice_p->brace_depth_beginning_ = brace_depth;
+		slice_p->line_offset_ = line_size;
+		slice_p->annotation_offset_ = annotation_size;
+		slice_p->block_offset_ = block_size;
+		slice_p->close_offset_ = close_size;
+		annotation_depth += slice_p->annotation_depth_;
+		brace_depth += slice_p->brace_depth_;
+		line_size += slice_p->line_table_.size();
+		annotation_size += slice_p->annotation_beginning_table_.size();
+		block_size += slice_p->block_beginning_table_.size();
+		close_size += slice_p->close_table_.size();
+	}
+	if (0 != annotation_depth || 0 != brace_depth)
+	{
+		return 0;
+	}
+	// blocks out of each slice: parent and root of the blocks whose parent is out of the slice, and the blocks which "}" out of them closes
+	// The blocks open at the beginning of a slice are kept in a stack (from the outermost one). The slice never touches the part of the stack below its lowest depth.
+	std::vector<int64_t> stack;
+	int64_t depth;
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		PreprocessSlice * slice_p = &(slice_table[i]);
+		slice_p->outer_parent_table_.resize(slice_p->outer_block_table_.size());
+		slice_p->outer_root_table_.resize(slice_p->outer_block_table_.size());
+		for (int64_t j = 0; j < slice_p->outer_block_table_.size(); ++j)
+		{
+			depth = slice_p->brace_depth_beginning_ + slice_p->outer_block_depth_table_[j];
+			if (0 == depth)
+			{
+				// the block of a function
+				slice_p->outer_parent_table_[j] = BlockTree::c_none_;
+				slice_p->outer_root_table_[j] = slice_p->block_offset_ + slice_p->outer_block_table_[j];
 			}
 			else
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 198;
+				slice_p->outer_parent_table_[j] = stack[depth - 1];
+				slice_p->outer_root_table_[j] = stack[0];
 			}
-			break;
-		case 198:
-			// fallback a char
-			Word::s_MoveBufferIndex(true, -1);
-			source_file_p->JumpTo(source_file_p->index_ - 1);
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
-			{
-				// set status (error)
-				status = 597;
+		}
+		slice_p->outer_close_block_table_.resize(slice_p->outer_close_depth_table_.size());
+		for (int64_t j = 0; j < slice_p->outer_close_depth_table_.size(); ++j)
+		{
+			slice_p->outer_close_block_table_[j] = stack[slice_p->brace_depth_beginning_ + slice_p->outer_close_depth_table_[j]];
+		}
+		stack.resize(slice_p->brace_depth_beginning_ + slice_p->brace_minimum_);
+		for (int64_t j = 0; j < slice_p->open_table_.size(); ++j)
+		{
+			stack.push_back(slice_p->block_offset_ + slice_p->open_table_[j]);
+		}
+	}
+	// step 5: copy each slice into its place
+	source_file_p->line_table_.resize(line_size);
+	source_file_p->line_table_[0] = 0;
+	source_file_p->annotation_table_.resize(annotation_size, NULL);
+	block_tree_p->Resize(block_size);
+	thread_pool_p->ParallelFor(slice_number, [&](int64_t i)
+	{
+		PreprocessSlice * slice_p = &(slice_table[i]);
+		AnnotationItem * annotation_item_p;
+		Block * block_p;
+		int64_t block;
+		int64_t parent;
+		int64_t outer = 0;
+		// line
+		for (int64_t j = 0; j < slice_p->line_table_.size(); ++j)
+		{
+			source_file_p->line_table_[slice_p->line_offset_ + j] = slice_p->line_table_[j];
+		}
+		// annotation
+		for (int64_t j = 0; j < slice_p->annotation_beginning_table_.size(); ++j)
+		{
+			annotation_item_p = AnnotationItem::s_Malloc();
+			if (NULL == annotation_item_p)
+			{
+				slice_p->succeeded_ = false;
+				return;
 			}
-			else
+			annotation_item_p->beginning_ = slice_p->annotation_beginning_table_[j];
+			annotation_item_p->end_ = slice_p->annotation_end_table_[j];
+			source_file_p->annotation_table_[slice_p->annotation_offset_ + j] = annotation_item_p;
+		}
+		// block: in order of "{", so the parent of a block in the slice is done before it
+		for (int64_t j = 0; j < slice_p->block_beginning_table_.size(); ++j)
+		{
+			block = slice_p->block_offset_ + j;
+			block_p = new Block();
+			if (NULL == block_p)
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_constant_int_;
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				slice_p->succeeded_ = false;
+				return;
 			}
-			break;
-		case 199:
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
+			block_p->id_ = block;
+			block_tree_p->block_table_[block] = block_p;
+			block_tree_p->beginning_table_[block] = slice_p->block_beginning_table_[j];
+			if (-1 != slice_p->block_end_table_[j])
 			{
-				// set status (error)
-				status = 597;
+				// The end of a block ending in a later slice is filled in by that slice.
+				block_tree_p->end_table_[block] = slice_p->block_end_table_[j];
+			}
+			if (BlockTree::c_none_ == slice_p->block_parent_table_[j])
+			{
+				// It is linked with its parent after all slices are done.
+				block_tree_p->parent_table_[block] = slice_p->outer_parent_table_[outer];
+				block_tree_p->root_table_[block] = slice_p->outer_root_table_[outer];
+				outer += 1;
 			}
 			else
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_constant_int_;
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				parent = slice_p->block_offset_ + slice_p->block_parent_table_[j];
+				block_tree_p->parent_table_[block] = parent;
+				block_tree_p->root_table_[block] = block_tree_p->root_table_[parent];
+				if (BlockTree::c_none_ == block_tree_p->last_child_table_[parent])
+				{
+					block_tree_p->first_child_table_[parent] = block;
+				}
+				else
+				{
+					block_tree_p->next_sibling_table_[block_tree_p->last_child_table_[parent]] = block;
+				}
+				block_tree_p->last_child_table_[parent] = block;
 			}
-			break;
-		case 201:
-			if ((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') || '_' == ch)
+		}
+		// blocks in order of "}"
+		outer = 0;
+		for (int64_t j = 0; j < slice_p->close_table_.size(); ++j)
+		{
+			if (BlockTree::c_none_ == slice_p->close_table_[j])
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 201;
+				block = slice_p->outer_close_block_table_[outer];
+				block_tree_p->end_table_[block] = slice_p->outer_close_location_table_[outer];
+				outer += 1;
 			}
 			else
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 299;
+				block = slice_p->block_offset_ + slice_p->close_table_[j];
 			}
-			break;
-		case 299:
-			// fallback a char
-			Word::s_MoveBufferIndex(true, -1);
-			source_file_p->JumpTo(source_file_p->index_ - 1);
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
-			{
-				// set status (error)
-				status = 597;
+			block_tree_p->end_order_table_[slice_p->close_offset_ + j] = block;
+		}
+	});
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		if (false == slice_table[i].succeeded_)
+		{
+			error_p->major_no_ = 1;
+			error_p->minor_no_ = 2;
+			return -1;
+		}
+	}
+	// step 6: what goes across slices, in order
+	FunctionItem * function_item_pointer = NULL;
+	int64_t block;
+	int64_t parent;
+	function_table_p->push_back(function_item_pointer);
+	(*function_table_p)[function_table_p->size() - 1] = FunctionItem::s_Malloc();
+	if (NULL == (*function_table_p)[function_table_p->size() - 1])
+	{
+		error_p->major_no_ = 1;
+		error_p->minor_no_ = 2;
+		return -1;
+	}
+	(*function_table_p)[function_table_p->size() - 1]->beginning_ = 0;
+	for (int64_t i = 0; i < slice_number; ++i)
+	{
+		PreprocessSlice * slice_p = &(slice_table[i]);
+		// annotation: The last end before the first beginning is the end of the last annotation of the slices before.
+		if (-1 != slice_p->outer_annotation_end_)
+		{
+			source_file_p->annotation_table_[slice_p->annotation_offset_ - 1]->end_ = slice_p->outer_annotation_end_;
+		}
+		// block: Link the blocks whose parent is out of the slice, as the last children (They come after the children in the slices before.).
+		for (int64_t j = 0; j < slice_p->outer_block_table_.size(); ++j)
+		{
+			parent = slice_p->outer_parent_table_[j];
+			if (BlockTree::c_none_ == parent)
+			{
+				continue;
+			}
+			block = slice_p->block_offset_ + slice_p->outer_block_table_[j];
+			if (BlockTree::c_none_ == block_tree_p->last_child_table_[parent])
+			{
+				block_tree_p->first_child_table_[parent] = block;
 			}
 			else
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_identifier_;
-				for (int64_t i = 0; i < Word::s_keyword_table_.size(); ++i)
-				{
-					if (0 == strcmp(Word::s_keyword_table_[i], word_p->content_))
-					{
-						word_p->type_ = Word::c_keyword_;
-					}
-				}
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				block_tree_p->next_sibling_table_[block_tree_p->last_child_table_[parent]] = block;
 			}
-			break;
-		case 301:
-			if (ch >= '1' && ch <= '9')
+			block_tree_p->last_child_table_[parent] = block;
+		}
+		// function: "}" down to the depth 0
+		for (int64_t j = 0; j < slice_p->bottom_close_table_.size(); ++j)
+		{
+			if (0 != slice_p->brace_depth_beginning_ + slice_p->bottom_close_depth_table_[j])
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 101;
+				continue;
 			}
-			else
+			block = block_tree_p->end_order_table_[slice_p->close_offset_ + slice_p->bottom_close_table_[j]];
+			(*function_table_p)[function_table_p->size() - 1]->end_ = slice_p->bottom_close_location_table_[j];
+			(*function_table_p)[function_table_p->size() - 1]->block_tree = block_tree_p->block_table_[block];
+			block_tree_p->block_table_[block]->function_ = (*function_table_p)[function_table_p->size() - 1];
+			function_table_p->push_back(function_item_pointer);
+			(*function_table_p)[function_table_p->size() - 1] = FunctionItem::s_Malloc();
+			if (NULL == (*function_table_p)[function_table_p->size() - 1])
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 398;
+				error_p->major_no_ = 1;
+				error_p->minor_no_ = 2;
+				return -1;
 			}
-			break;
-		case 302:
-			if ('=' == ch)
+			(*function_table_p)[function_table_p->size() - 1]->beginning_ = slice_p->bottom_close_location_table_[j] + 1;
+		}
+	}
+	// function: Remove the final item in function table because it must be incorrect.
+	FunctionItem::s_Free((*function_table_p)[function_table_p->size() - 1]);
+	function_table_p->pop_back();
+	// size
+	source_file_p->line_size_ = source_file_p->line_table_.size();
+	source_file_p->annotation_size_ = source_file_p->annotation_table_.size();
+	// get ready
+	source_file_p->ReadyToMove();
+	return 1;
+}
+
+void Preprocess_Slice(SourceFile * source_file_p, const std::vector<int64_t> * structure_table_p, PreprocessSlice * slice_p)
+{
+	// Traverse the structural characters of a slice as the serial traversal in function "Preprocess" does, but into the tables of the slice only. "slice_p->annotation_" must be set first.
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"void Preprocess_Slice(SourceFile * source_file_p, const std::vector<int64_t> * structure_table_p, PreprocessSlice * slice_p)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == structure_table_p)
+	{
+		throw std::exception("Function \"void Preprocess_Slice(SourceFile * source_file_p, const std::vector<int64_t> * structure_table_p, PreprocessSlice * slice_p)\" says: Invalid parameter \"structure_table_p\".");
+	}
+	if (NULL == slice_p)
+	{
+		throw std::exception("Function \"void Preprocess_Slice(SourceFile * source_file_p, const std::vector<int64_t> * structure_table_p, PreprocessSlice * slice_p)\" says: Invalid parameter \"slice_p\".");
+	}
+	const char * content = source_file_p->content_;
+	int64_t size = source_file_p->content_size_;
+	bool annotation = slice_p->annotation_;
+	int64_t annotation_depth = 0;
+	int64_t brace_depth = 0;
+	// stack of blocks of the slice: The blocks below its bottom are out of the slice.
+	std::vector<int64_t> stack;
+	int64_t index;
+	int64_t block;
+	for (int64_t i = slice_p->beginning_; i < slice_p->end_; ++i)
+	{
+		// The second character of a pair is not in the table.
+		index = (*structure_table_p)[i];
+		switch (content[index])
+		{
+			// line feed: If the final character is LF, there is no final line.
+		case '\r':
+			if (index < size - 1 && content[index + 1] == '\n')
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 399;
+				// Windows LF: \r\n
+				if (index + 2 < size)
+				{
+					slice_p->line_table_.push_back(index + 2);
+				}
 			}
 			else
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 398;
+				// Mac OS LF : \r
+				if (index + 1 < size)
+				{
+					slice_p->line_table_.push_back(index + 1);
+				}
 			}
 			break;
-		case 303:
-			if ('$' == ch)
+		case '\n':
+			// Linux LF: \n
+			if (index + 1 < size)
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 399;
+				slice_p->line_table_.push_back(index + 1);
 			}
-			else
+			break;
+		case '/':
+			if (index < size - 1 && content[index + 1] == '*')
 			{
-				// read a char
-				Word::s_buffer_[Word::s_buffer_index_] = ch;
-				Word::s_MoveBufferIndex(true, 1);
-				// set status
-				status = 398;
+				// annotation beginning: /*
+				annotation_depth += 1;
+				annotation = true;
+				slice_p->annotation_beginning_table_.push_back(index);
+				slice_p->annotation_end_table_.push_back(-1);
 			}
 			break;
-		case 398:
-			// fallback a char
-			Word::s_MoveBufferIndex(true, -1);
-			source_file_p->JumpTo(source_file_p->index_ - 1);
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
-			{
-				// set status (error)
-				status = 597;
-			}
-			else
+		case '*':
+			if (index < size - 1 && content[index + 1] == '/')
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_operator_;
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				// annotation end: */ (It ends the last annotation so far.)
+				annotation_depth -= 1;
+				if (annotation_depth < slice_p->annotation_minimum_)
+				{
+					slice_p->annotation_minimum_ = annotation_depth;
+				}
+				annotation = false;
+				if (slice_p->annotation_end_table_.empty())
+				{
+					slice_p->outer_annotation_end_ = index + 1;
+				}
+				else
+				{
+					slice_p->annotation_end_table_[slice_p->annotation_end_table_.size() - 1] = index + 1;
+				}
 			}
 			break;
-		case 399:
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
+		case '{':
+			if (annotation)
+			{
+				break;
+			}
+			block = slice_p->block_beginning_table_.size();
+			slice_p->block_beginning_table_.push_back(index);
+			slice_p->block_end_table_.push_back(-1);
+			if (stack.empty())
 			{
-				// set status (error)
-				status = 597;
+				slice_p->block_parent_table_.push_back(BlockTree::c_none_);
+				slice_p->outer_block_table_.push_back(block);
+				slice_p->outer_block_depth_table_.push_back(brace_depth);
 			}
 			else
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_operator_;
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				slice_p->block_parent_table_.push_back(stack[stack.size() - 1]);
 			}
+			stack.push_back(block);
+			brace_depth += 1;
 			break;
-		case 499:
-			// add a word
-			word_previous_p = word_p;
-			word_p = Word::s_Insert(word_previous_p);
-			if (NULL == word_p)
+		case '}':
+			if (annotation)
+			{
+				break;
+			}
+			brace_depth -= 1;
+			if (stack.empty())
 			{
-				// set status (error)
-				status = 597;
+				slice_p->close_table_.push_back(BlockTree::c_none_);
+				slice_p->outer_close_location_table_.push_back(index);
+				slice_p->outer_close_depth_table_.push_back(brace_depth);
 			}
 			else
 			{
-				// set word
-				word_p->SetContent(Word::s_buffer_);
-				word_p->type_ = Word::c_separator_;
-				word_p->source_file_index_ = source_file_p->index_;
-				// reset global buffer
-				Word::s_MoveBufferIndex(false, 0);
-				// set status
-				status = 0;
+				block = stack[stack.size() - 1];
+				stack.pop_back();
+				slice_p->block_end_table_[block] = index;
+				slice_p->close_table_.push_back(block);
+			}
+			if (brace_depth <= slice_p->brace_minimum_)
+			{
+				slice_p->brace_minimum_ = brace_depth;
+				slice_p->bottom_close_table_.push_back(slice_p->close_table_.size() - 1);
+				slice_p->bottom_close_location_table_.push_back(index);
+				slice_p->bottom_close_depth_table_.push_back(brace_depth);
 			}
 			break;
-		case 597:
-			// error: out of memory
-			error_p->major_no_ = 2;
-			error_p->minor_no_ = 3;
-			return -1;
-		case 598:
-			// error: illegal character
-			error_p->major_no_ = 2;
-			error_p->minor_no_ = 2;
-			return -1;
-		case 599:
-			// error: unrecognized word
-			error_p->major_no_ = 2;
-			error_p->minor_no_ = 1;
-			return -1;
 		default:
-			throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\" says: Invalid variable \"status\".");
 			break;
 		}
-		if (status != 198 && status != 199 && status != 299 && status != 398 && status != 399 && status != 499)
-		{
-			// move to the next char
-			source_file_p->MoveNext();
-			// get a char
-			ch = source_file_p->content_[source_file_p->index_];
-		}
 	}
-	return 1;
+	slice_p->annotation_depth_ = annotation_depth;
+	slice_p->brace_depth_ = brace_depth;
+	slice_p->open_table_ = stack;
 }
 
-void RemoveBlankWord(bool is_block, void * pointer)
+int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)
 {
-	if (NULL == pointer)
+	if (NULL == source_file_p)
 	{
-		throw std::exception("Function \"void RemoveBlankWord(bool is_block, void * pointer)\" says: Invalid parameter \"pointer\".");
+		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)\" says: Invalid parameter \"pointer\".");
 	}
-	Block * block_p;
 	FunctionItem * function_item_p;
-	Word * word_p;
-	Word * word_next_p;
+	Block * block_p;
+	TokenStream * token_stream_p;
+	int64_t index;
+	int64_t end;
+	int64_t block_level;
+	int64_t block_child;
 	if (is_block)
 	{
 		// block
 		block_p = (Block *)pointer;
 		function_item_p = NULL;
-		word_p = block_p->word_header.next_;
-		// remove "{" in the beginning
-		word_next_p = word_p->next_;
-		Word::s_Remove(word_p);
-		word_p = word_next_p;
+		token_stream_p = &(block_p->token_stream);
+		index = source_file_p->ToShadow(block_tree_p->beginning_table_[block_p->id_]);
+		end = source_file_p->ToShadow(block_tree_p->end_table_[block_p->id_]);
+		block_level = 0;
+		block_child = block_tree_p->first_child_table_[block_p->id_];
 	}
 	else
 	{
 		// function (head)
 		block_p = NULL;
 		function_item_p = (FunctionItem *)pointer;
-		word_p = function_item_p->word_header.next_;
+		token_stream_p = &(function_item_p->token_stream);
+		index = source_file_p->ToShadow(function_item_p->beginning_);
+		end = source_file_p->ToShadow(function_item_p->end_);
+		block_level = 1;
+		block_child = NULL == function_item_p->block_tree ? BlockTree::c_none_ : function_item_p->block_tree->id_;
+	}
+	return LexicalAnalyse_Range(source_file_p, error_p, block_tree_p, token_stream_p, index, end, block_level, block_child);
+}
+
+int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child)
+{
+	// Analyse the range from "index" to "end" in the shadow. "block_level" is the level of "{" before it, and "block_child" is the next child block to be ignored (Child blocks come in order of their siblings.).
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child)\" says: Invalid parameter \"block_tree_p\".");
 	}
-	while (word_p)
+	if (NULL == token_stream_p)
 	{
-		word_next_p = word_p->next_;
-		if (is_block && NULL == word_next_p)
+		throw std::exception("Function \"int64_t LexicalAnalyse_Range(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, TokenStream * token_stream_p, int64_t index, int64_t end, int64_t block_level, int64_t block_child)\" says: Invalid parameter \"token_stream_p\".");
+	}
+	// The shadow (without annotations) is traversed instead of the content.
+	const char * shadow = source_file_p->shadow_;
+	// Each token is a view of the shadow.
+	token_stream_p->SetText(shadow);
+	// DFA: See "lexical_table.h".
+	int64_t status = LexicalTable::c_state_start_;
+	int64_t beginning = index;
+	int64_t location;
+	int64_t type;
+	int64_t length;
+	char ch;
+	while (index <= end)
+	{
+		// get a char
+		ch = shadow[index];
+		if (LexicalTable::c_state_start_ == status)
+		{
+			// blank: skip the run, and no word is added
+			if (LexicalTable::c_class_blank_ == LexicalTable::s_class_table_[(unsigned char)ch])
+			{
+				index = Scanner::s_SearchRunEnd(shadow, index, end + 1, Scanner::c_run_blank_);
+				continue;
+			}
+			beginning = index;
+		}
+		// set status
+		status = LexicalTable::s_transition_table_[status][LexicalTable::s_class_table_[(unsigned char)ch]];
+		if (status < LexicalTable::c_state_accept_)
+		{
+			// move to the next char
+			index += 1;
+			// skip the rest of an integer or an identifier: The char behind it makes the word accepted.
+			if (LexicalTable::c_state_integer_ == status)
+			{
+				index = Scanner::s_SearchRunEnd(shadow, index, end + 1, Scanner::c_run_digit_);
+			}
+			else if (LexicalTable::c_state_identifier_ == status)
+			{
+				index = Scanner::s_SearchRunEnd(shadow, index, end + 1, Scanner::c_run_identifier_);
+			}
+			continue;
+		}
+		if (LexicalTable::c_state_illegal_ == status)
+		{
+			// error: illegal character
+			error_p->location_ = source_file_p->FromShadow(index + 1);
+			error_p->major_no_ = 2;
+			error_p->minor_no_ = 2;
+			return -1;
+		}
+		// add a word: The char fallen back is not a part of it.
+		length = LexicalTable::s_fallback_table_[status] ? index - beginning : index - beginning + 1;
+		// A keyword is found by function "TokenStream::s_GetSymbol".
+		type = LexicalTable::s_word_type_table_[status];
+		if (LexicalTable::s_fallback_table_[status])
 		{
-			// remove "}" in the end
-			Word::s_Remove(word_p);
-			word_p = NULL;
+			// just before the char fallen back (It may be in an annotation.)
+			token_stream_p->Append(type, source_file_p->FromShadow(index) - 1, beginning, length);
 		}
 		else
 		{
-			// remove blank word
-			if (Word::c_separator_ == word_p->type_)
+			if ('{' == ch)
 			{
-				switch (word_p->content_[0])
+				// ignore child block (+)
+				block_level += 1;
+				if (block_level >= 2)
 				{
-				case ' ':
-				case '\t':
-				case '\r':
-				case '\n':
-					Word::s_Remove(word_p);
-					break;
-				default:
-					break;
+					// jump index
+					location = source_file_p->FromShadow(index);
+					if (BlockTree::c_none_ == block_child || block_tree_p->beginning_table_[block_child] != location)
+					{
+						block_child = block_tree_p->SearchByBeginning(location);
+					}
+					if (BlockTree::c_none_ != block_child)
+					{
+						index = source_file_p->ToShadow(block_tree_p->end_table_[block_child] - 1);
+						block_child = block_tree_p->next_sibling_table_[block_child];
+					}
 				}
 			}
-			word_p = word_next_p;
+			else if ('}' == ch)
+			{
+				// ignore child block (-)
+				block_level -= 1;
+			}
+			token_stream_p->Append(type, source_file_p->FromShadow(index), beginning, length);
+			// move to the next char
+			index += 1;
 		}
+		// set status
+		status = LexicalTable::c_state_start_;
 	}
+	return 1;
 }
 
-int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p)
+void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)
 {
+	// Split a large block into pieces of about "TokenStream::c_piece_size_" chars in the shadow, and return the end of each piece but the last one, with the next child block behind it.
+	// A piece ends at a blank or ";" out of child blocks, where no word goes on and the DFA goes back to the start. The shadow has no annotation, so the char is never in an annotation.
 	if (NULL == source_file_p)
 	{
-		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p)\" says: Invalid parameter \"source_file_p\".");
+		throw std::exception("Function \"void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)\" says: Invalid parameter \"source_file_p\".");
 	}
-	if (NULL == error_p)
+	if (NULL == block_tree_p)
 	{
-		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p)\" says: Invalid parameter \"error_p\".");
+		throw std::exception("Function \"void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)\" says: Invalid parameter \"block_tree_p\".");
 	}
-	if (NULL == function_item_p)
+	if (block < 0 || block >= block_tree_p->size_)
 	{
-		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p)\" says: Invalid parameter \"function_item_p\".");
+		throw std::exception("Function \"void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)\" says: Invalid parameter \"block\".");
 	}
-	Word * word_p = function_item_p->word_header.next_;
-	int64_t parameter_number = 0;
-	bool end = false;
-	// type of return value
-	VariableItem * pointer;
-	if (NULL == word_p)
+	if (NULL == split_table_p)
 	{
-		// error
-		error_p->major_no_ = 3;
-		error_p->minor_no_ = 1;
-		source_file_p->JumpTo(function_item_p->beginning_);
-		return -1;
+		throw std::exception("Function \"void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)\" says: Invalid parameter \"split_table_p\".");
 	}
-	if (word_p->type_ != Word::c_keyword_)
+	if (NULL == child_table_p)
 	{
-		// error
-		error_p->major_no_ = 3;
-		error_p->minor_no_ = 2;
-		source_file_p->JumpTo(word_p->source_file_index_);
-		return -1;
+		throw std::exception("Function \"void LexicalAnalyse_Split(SourceFile * source_file_p, BlockTree * block_tree_p, int64_t block, std::vector<int64_t> * split_table_p, std::vector<int64_t> * child_table_p)\" says: Invalid parameter \"child_table_p\".");
 	}
-	if (0 == strcmp(word_p->content_, "void"))
+	const char * shadow = source_file_p->shadow_;
+	int64_t end = source_file_p->ToShadow(block_tree_p->end_table_[block]);
+	int64_t index = source_file_p->ToShadow(block_tree_p->beginning_table_[block]) + TokenStream::c_piece_size_;
+	int64_t child = block_tree_p->first_child_table_[block];
+	char ch;
+	split_table_p->clear();
+	child_table_p->clear();
+	while (index < end)
 	{
-		function_item_p->return_type_ = VariableItem::c_void_;
+		// skip child blocks before the index
+		while (BlockTree::c_none_ != child && source_file_p->ToShadow(block_tree_p->end_table_[child]) < index)
+		{
+			child = block_tree_p->next_sibling_table_[child];
+		}
+		if (BlockTree::c_none_ != child && source_file_p->ToShadow(block_tree_p->beginning_table_[child]) <= index)
+		{
+			// in a child block: Search behind it.
+			index = source_file_p->ToShadow(block_tree_p->end_table_[child]) + 1;
+			continue;
+		}
+		ch = shadow[index];
+		if (LexicalTable::c_class_blank_ == LexicalTable::s_class_table_[(unsigned char)ch] || ';' == ch)
+		{
+			split_table_p->push_back(index);
+			child_table_p->push_back(child);
+			index += TokenStream::c_piece_size_;
+			continue;
+		}
+		index += 1;
 	}
-	else if (0 == strcmp(word_p->content_, "int"))
+}
+
+void RemoveBlankWord(bool is_block, void * pointer)
+{
+	if (NULL == pointer)
 	{
-		function_item_p->return_type_ = VariableItem::c_int_;
+		throw std::exception("Function \"void RemoveBlankWord(bool is_block, void * pointer)\" says: Invalid parameter \"pointer\".");
 	}
-	else
+	if (is_block)
 	{
-		// error
-		error_p->major_no_ = 3;
-		error_p->minor_no_ = 2;
-		source_file_p->JumpTo(word_p->source_file_index_);
-		return -1;
+		// block: remove "{" in the beginning, "}" in the end and blank words
+		((Block *)pointer)->token_stream.RemoveBlank(true);
 	}
-	// function name
-	word_p = word_p->next_;
-	if (NULL == word_p)
+	else
 	{
-		// error
-		error_p->major_no_ = 3;
-		error_p->minor_no_ = 3;
-		source_file_p->JumpTo(function_item_p->beginning_);
-		return -1;
+		// function (head): remove blank words
+		((FunctionItem *)pointer)->token_stream.RemoveBlank(false);
 	}
-	if (word_p->type_ != Word::c_identifier_)
+}
+
+int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)
+{
+	// Function heads and blocks are analysed in parallel. The error reported is the first one in order (function heads, then blocks), as if they were analysed one by one.
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == function_table_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"int64_t LexicalAnalyseInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	int64_t function_number = function_table_p->size();
+	// pieces of blocks in order: A block is one piece, unless it is large and there are more threads. (See function "LexicalAnalyse_Split".)
+	std::vector<int64_t> piece_block_table;
+	std::vector<int64_t> piece_beginning_table; // in the shadow
+	std::vector<int64_t> piece_end_table;
+	std::vector<int64_t> piece_child_table;
+	std::vector<TokenStream *> piece_stream_table; // words of a piece of a split block (NULL for a whole block)
+	std::vector<int64_t> piece_index_table; // index of its first word in the block
+	std::vector<int64_t> split_table;
+	std::vector<int64_t> child_table;
+	int64_t piece_number;
+	int64_t word_number;
+	for (int64_t i = 0; i < block_tree_p->size_; ++i)
+	{
+		split_table.clear();
+		if (thread_pool_p->thread_number_ > 1)
+		{
+			LexicalAnalyse_Split(source_file_p, block_tree_p, i, &split_table, &child_table);
+		}
+		piece_block_table.push_back(i);
+		piece_beginning_table.push_back(source_file_p->ToShadow(block_tree_p->beginning_table_[i]));
+		piece_child_table.push_back(block_tree_p->first_child_table_[i]);
+		piece_stream_table.push_back(split_table.empty() ? NULL : new TokenStream());
+		for (int64_t j = 0; j < (int64_t)split_table.size(); ++j)
+		{
+			piece_end_table.push_back(split_table[j]);
+			piece_block_table.push_back(i);
+			piece_beginning_table.push_back(split_table[j] + 1);
+			piece_child_table.push_back(child_table[j]);
+			piece_stream_table.push_back(new TokenStream());
+		}
+		piece_end_table.push_back(source_file_p->ToShadow(block_tree_p->end_table_[i]));
+	}
+	piece_number = piece_block_table.size();
+	FirstError first_error(function_number + piece_number);
+	thread_pool_p->ParallelFor(function_number + piece_number, [&](int64_t i)
+	{
+		Error error;
+		if (first_error.IsSkipped(i))
+		{
+			return;
+		}
+		if (i < function_number)
+		{
+			if (-1 == LexicalAnalyse(source_file_p, &error, block_tree_p, false, (*function_table_p)[i]))
+			{
+				first_error.Fail(i, &error);
+			}
+		}
+		else if (NULL == piece_stream_table[i - function_number])
+		{
+			if (-1 == LexicalAnalyse(source_file_p, &error, block_tree_p, true, block_tree_p->block_table_[piece_block_table[i - function_number]]))
+			{
+				first_error.Fail(i, &error);
+			}
+		}
+		else
+		{
+			// The first piece begins with "{" of the block, and the others are in it.
+			int64_t piece = i - function_number;
+			int64_t block_level = 0 == piece || piece_block_table[piece - 1] != piece_block_table[piece] ? 0 : 1;
+			if (-1 == LexicalAnalyse_Range(source_file_p, &error, block_tree_p, piece_stream_table[piece], piece_beginning_table[piece], piece_end_table[piece], block_level, piece_child_table[piece]))
+			{
+				first_error.Fail(i, &error);
+			}
+		}
+	});
+	if (-1 == first_error.Report(error_p))
+	{
+		for (int64_t i = 0; i < piece_number; ++i)
+		{
+			delete piece_stream_table[i];
+		}
+		return -1;
+	}
+	// Join the pieces of each split block in order: Their places are known, so they are copied in parallel.
+	piece_index_table.resize(piece_number);
+	word_number = 0;
+	for (int64_t i = 0; i < piece_number; ++i)
+	{
+		if (NULL == piece_stream_table[i])
+		{
+			continue;
+		}
+		piece_index_table[i] = word_number;
+		word_number += piece_stream_table[i]->size_;
+		if (piece_number - 1 == i || piece_block_table[i + 1] != piece_block_table[i])
+		{
+			block_tree_p->block_table_[piece_block_table[i]]->token_stream.SetText(source_file_p->shadow_);
+			block_tree_p->block_table_[piece_block_table[i]]->token_stream.Resize(word_number);
+			word_number = 0;
+		}
+	}
+	thread_pool_p->ParallelFor(piece_number, [&](int64_t i)
+	{
+		if (NULL != piece_stream_table[i])
+		{
+			block_tree_p->block_table_[piece_block_table[i]]->token_stream.Assign(piece_index_table[i], piece_stream_table[i]);
+			delete piece_stream_table[i];
+		}
+	});
+	return 1;
+}
+
+void RemoveBlankWordInParallel(std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)
+{
+	if (NULL == function_table_p)
+	{
+		throw std::exception("Function \"void RemoveBlankWordInParallel(std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"void RemoveBlankWordInParallel(std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"void RemoveBlankWordInParallel(std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	int64_t function_number = function_table_p->size();
+	thread_pool_p->ParallelFor(function_number + block_tree_p->size_, [&](int64_t i)
+	{
+		if (i < function_number)
+		{
+			RemoveBlankWord(false, (*function_table_p)[i]);
+		}
+		else
+		{
+			RemoveBlankWord(true, block_tree_p->block_table_[i - function_number]);
+		}
+	});
+}
+
+int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p, SymbolTable * symbol_table_p)
+{
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p, SymbolTable * symbol_table_p)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p, SymbolTable * symbol_table_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == function_item_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionItem * function_item_p, SymbolTable * symbol_table_p)\" says: Invalid parameter \"function_item_p\".");
+	}
+	TokenStream * token_stream_p = &(function_item_p->token_stream);
+	int64_t word = 0;
+	char text[TokenStream::c_text_size_];
+	int64_t parameter_number = 0;
+	bool end = false;
+	// type of return value
+	VariableItem * pointer;
+	if (word >= token_stream_p->size_)
+	{
+		// error
+		error_p->major_no_ = 3;
+		error_p->minor_no_ = 1;
+		error_p->location_ = function_item_p->beginning_;
+		return -1;
+	}
+	if (TokenStream::c_keyword_ != token_stream_p->type_table_[word])
+	{
+		// error
+		error_p->major_no_ = 3;
+		error_p->minor_no_ = 2;
+		error_p->location_ = token_stream_p->location_table_[word];
+		return -1;
+	}
+	// "void" is the only keyword without terminal symbol.
+	if (-1 == token_stream_p->symbol_table_[word])
+	{
+		function_item_p->return_type_ = VariableItem::c_void_;
+	}
+	else if (18 == token_stream_p->symbol_table_[word])
+	{
+		function_item_p->return_type_ = VariableItem::c_int_;
+	}
+	else
+	{
+		// error
+		error_p->major_no_ = 3;
+		error_p->minor_no_ = 2;
+		error_p->location_ = token_stream_p->location_table_[word];
+		return -1;
+	}
+	// function name
+	word += 1;
+	if (word >= token_stream_p->size_)
+	{
+		// error
+		error_p->major_no_ = 3;
+		error_p->minor_no_ = 3;
+		error_p->location_ = function_item_p->beginning_;
+		return -1;
+	}
+	if (TokenStream::c_identifier_ != token_stream_p->type_table_[word])
 	{
 		// error
 		error_p->major_no_ = 3;
 		error_p->minor_no_ = 4;
-		source_file_p->JumpTo(word_p->source_file_index_);
+		error_p->location_ = token_stream_p->location_table_[word];
 		return -1;
 	}
-	function_item_p->SetName(word_p->content_);
+	function_item_p->SetName(token_stream_p->CopyText(word, text));
+	function_item_p->name_id_ = token_stream_p->id_table_[word];
 	// "("
-	word_p = word_p->next_;
-	if (NULL == word_p)
+	word += 1;
+	if (word >= token_stream_p->size_)
 	{
 		// error
 		error_p->major_no_ = 3;
 		error_p->minor_no_ = 3;
-		source_file_p->JumpTo(function_item_p->beginning_);
+		error_p->location_ = function_item_p->beginning_;
 		return -1;
 	}
-	if (word_p->type_ != Word::c_operator_ || word_p->content_[0] != '(')
+	if (TokenStream::c_operator_ != token_stream_p->type_table_[word] || token_stream_p->GetText(word)[0] != '(')
 	{
 		// error
 		error_p->major_no_ = 3;
 		error_p->minor_no_ = 5;
-		source_file_p->JumpTo(word_p->source_file_index_);
+		error_p->location_ = token_stream_p->location_table_[word];
 		return -1;
 	}
 	// function with no parameter
-	if (word_p != NULL && word_p->next_ != NULL && ')' == word_p->next_->content_[0])
+	if (word + 1 < token_stream_p->size_ && ')' == token_stream_p->GetText(word + 1)[0])
 	{
 		end = true;
 	}
@@ -1290,25 +1817,25 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 	while (false == end)
 	{
 		// type of parameter
-		word_p = word_p->next_;
-		if (NULL == word_p)
+		word += 1;
+		if (word >= token_stream_p->size_)
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 3;
-			source_file_p->JumpTo(function_item_p->beginning_);
+			error_p->location_ = function_item_p->beginning_;
 			return -1;
 		}
-		if (strcmp(word_p->content_, "int"))
+		if (18 != token_stream_p->symbol_table_[word])
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 6;
-			source_file_p->JumpTo(word_p->source_file_index_);
+			error_p->location_ = token_stream_p->location_table_[word];
 			return -1;
 		}
 		function_item_p->parameter_table_.push_back(pointer);
-		function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1] = VariableItem::s_Malloc();
+		function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1] = VariableItem::s_Malloc(&(function_item_p->arena));
 		if (NULL == function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1])
 		{
 			error_p->major_no_ = 3;
@@ -1317,56 +1844,51 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 		}
 		function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->type_ = VariableItem::c_int_;
 		// parameter name
-		word_p = word_p->next_;
-		if (NULL == word_p)
+		word += 1;
+		if (word >= token_stream_p->size_)
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 3;
-			source_file_p->JumpTo(function_item_p->beginning_);
+			error_p->location_ = function_item_p->beginning_;
 			return -1;
 		}
-		if (word_p->type_ != Word::c_identifier_)
+		if (TokenStream::c_identifier_ != token_stream_p->type_table_[word])
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 7;
-			source_file_p->JumpTo(word_p->source_file_index_);
-			return -1;
-		}
-		if (-1 == function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->SetName(word_p->content_))
-		{
-			// error
-			error_p->major_no_ = 3;
-			error_p->minor_no_ = 10;
+			error_p->location_ = token_stream_p->location_table_[word];
 			return -1;
 		}
-		sprintf(VariableItem::s_buffer_, "function_%s_%s", function_item_p->name_, word_p->content_);
-		if (-1 == function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->SetGlobalName(VariableItem::s_buffer_))
+		if (-1 == function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->SetName(token_stream_p->CopyText(word, text), &(function_item_p->arena)))
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 10;
 			return -1;
 		}
+		function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->name_id_ = token_stream_p->id_table_[word];
+		function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1]->function_id_ = function_item_p->name_id_;
+		symbol_table_p->Insert(token_stream_p->id_table_[word], function_item_p->block_tree->id_, function_item_p->parameter_table_[function_item_p->parameter_table_.size() - 1], true);
 		// "," or ")"
-		word_p = word_p->next_;
-		if (NULL == word_p)
+		word += 1;
+		if (word >= token_stream_p->size_)
 		{
 			// error
 			error_p->major_no_ = 3;
 			error_p->minor_no_ = 3;
-			source_file_p->JumpTo(function_item_p->beginning_);
+			error_p->location_ = function_item_p->beginning_;
 			return -1;
 		}
-		if (word_p->type_ != Word::c_separator_ || word_p->content_[0] != ',')
+		if (TokenStream::c_separator_ != token_stream_p->type_table_[word] || token_stream_p->GetText(word)[0] != ',')
 		{
-			if (word_p->type_ != Word::c_operator_ || word_p->content_[0] != ')')
+			if (TokenStream::c_operator_ != token_stream_p->type_table_[word] || token_stream_p->GetText(word)[0] != ')')
 			{
 				// error
 				error_p->major_no_ = 3;
 				error_p->minor_no_ = 8;
-				source_file_p->JumpTo(word_p->source_file_index_);
+				error_p->location_ = token_stream_p->location_table_[word];
 				return -1;
 			}
 			else
@@ -1376,7 +1898,7 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 		}
 	}
 	// [label_1]:
-	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), function_item_p->name_, NULL, NULL, NULL))
+	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_function_, function_item_p->name_id_))
 	{
 		// error
 		error_p->major_no_ = 3;
@@ -1384,7 +1906,7 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 		return -1;
 	}
 	// JMP [function_item_p->block_tree->name_in_]
-	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), NULL, "JMP", NULL, function_item_p->block_tree->name_in_))
+	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, CodeItem::s_GetLabel(function_item_p->block_tree->id_, CodeItem::c_in_label_)))
 	{
 		// error
 		error_p->major_no_ = 3;
@@ -1392,7 +1914,7 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 		return -1;
 	}
 	// [function_item_p->block_tree->name_out_]:
-	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), function_item_p->block_tree->name_out_, NULL, NULL, NULL))
+	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, CodeItem::s_GetLabel(function_item_p->block_tree->id_, CodeItem::c_out_label_)))
 	{
 		// error
 		error_p->major_no_ = 3;
@@ -1400,7 +1922,7 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 		return -1;
 	}
 	// RET RC1
-	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), NULL, "RET", NULL, "RC1"))
+	if (-1 == GenerateIntermediate(&(function_item_p->intermediate), CodeItem::c_ret_, CodeItem::c_none_, -1, CodeItem::c_register_, CodeItem::c_rc1_))
 	{
 		// error
 		error_p->major_no_ = 3;
@@ -1410,11 +1932,52 @@ int64_t ParseFunctionHead(SourceFile * source_file_p, Error * error_p, FunctionI
 	return 1;
 }
 
+int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)
+{
+	// Each function head only inserts its parameters into the scope of its own block.
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == function_table_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
+	}
+	if (NULL == symbol_table_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"symbol_table_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"int64_t ParseFunctionHeadInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	FirstError first_error(function_table_p->size());
+	thread_pool_p->ParallelFor(function_table_p->size(), [&](int64_t i)
+	{
+		Error error;
+		if (first_error.IsSkipped(i))
+		{
+			return;
+		}
+		if (-1 == ParseFunctionHead(source_file_p, &error, (*function_table_p)[i], symbol_table_p))
+		{
+			first_error.Fail(i, &error);
+		}
+	});
+	return first_error.Report(error_p);
+}
+
 int64_t SearchFunctionMain(Error * error_p, std::vector<FunctionItem *> * function_table_p)
 {
+	// "-1" if "main" has never been met
+	int32_t main_id = Interner::s_interner_.Search("main", 4);
 	for (int64_t i = 0; i < function_table_p->size(); ++i)
 	{
-		if (0 == strcmp((*function_table_p)[i]->name_, "main"))
+		if (main_id == (*function_table_p)[i]->name_id_)
 		{
 			return 1;
 		}
@@ -1425,7 +1988,7 @@ int64_t SearchFunctionMain(Error * error_p, std::vector<FunctionItem *> * functi
 	return -1;
 }
 
-int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)
+int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine)
 {
 	if (NULL == source_file_p)
 	{
@@ -1439,181 +2002,11 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 	{
 		throw std::exception("Function \"int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p)\" says: Invalid parameter \"block_p\".");
 	}
-	char priority_table[28][28];
-	const char undefined = 'u';
-	const char c_equal_to = '=';
-	const char c_less_than = '<';
-	const char c_greater_than = '>';
-	// u : initialization
-	for (int64_t i = 0; i < 28; ++i)
-	{
-		for (int64_t j = 0; j < 28; ++j)
-		{
-			priority_table[i][j] = undefined;
-		}
-	}
-	// = : 18 items
-	priority_table[0][0] = c_equal_to;
-	priority_table[1][14] = c_equal_to;
-	priority_table[1][26] = c_equal_to;
-	priority_table[2][0] = c_equal_to;
-	priority_table[8][9] = c_equal_to;
-	priority_table[9][16] = c_equal_to;
-	priority_table[16][17] = c_equal_to;
-	priority_table[17][20] = c_equal_to;
-	priority_table[18][26] = c_equal_to;
-	priority_table[19][8] = c_equal_to;
-	priority_table[20][16] = c_equal_to;
-	priority_table[21][8] = c_equal_to;
-	priority_table[22][14] = c_equal_to;
-	priority_table[23][1] = c_equal_to;
-	priority_table[24][1] = c_equal_to;
-	priority_table[26][1] = c_equal_to;
-	priority_table[26][2] = c_equal_to;
-	priority_table[26][8] = c_equal_to;
-	// < : 59 + 27 items
-	priority_table[0][26] = c_less_than;
-	priority_table[2][3] = c_less_than;
-	priority_table[2][4] = c_less_than;
-	priority_table[2][5] = c_less_than;
-	priority_table[2][6] = c_less_than;
-	priority_table[2][7] = c_less_than;
-	priority_table[2][8] = c_less_than;
-	priority_table[2][25] = c_less_than;
-	priority_table[2][26] = c_less_than;
-	priority_table[3][5] = c_less_than;
-	priority_table[3][6] = c_less_than;
-	priority_table[3][7] = c_less_than;
-	priority_table[3][8] = c_less_than;
-	priority_table[3][25] = c_less_than;
-	priority_table[3][26] = c_less_than;
-	priority_table[4][5] = c_less_than;
-	priority_table[4][6] = c_less_than;
-	priority_table[4][7] = c_less_than;
-	priority_table[4][8] = c_less_than;
-	priority_table[4][25] = c_less_than;
-	priority_table[4][26] = c_less_than;
-	priority_table[5][8] = c_less_than;
-	priority_table[5][25] = c_less_than;
-	priority_table[5][26] = c_less_than;
-	priority_table[6][8] = c_less_than;
-	priority_table[6][25] = c_less_than;
-	priority_table[6][26] = c_less_than;
-	priority_table[7][8] = c_less_than;
-	priority_table[7][25] = c_less_than;
-	priority_table[7][26] = c_less_than;
-	priority_table[8][3] = c_less_than;
-	priority_table[8][4] = c_less_than;
-	priority_table[8][5] = c_less_than;
-	priority_table[8][6] = c_less_than;
-	priority_table[8][7] = c_less_than;
-	priority_table[8][8] = c_less_than;
-	priority_table[8][10] = c_less_than;
-	priority_table[8][11] = c_less_than;
-	priority_table[8][12] = c_less_than;
-	priority_table[8][13] = c_less_than;
-	priority_table[8][15] = c_less_than;
-	priority_table[8][25] = c_less_than;
-	priority_table[8][26] = c_less_than;
-	priority_table[10][25] = c_less_than;
-	priority_table[10][26] = c_less_than;
-	priority_table[11][25] = c_less_than;
-	priority_table[11][26] = c_less_than;
-	priority_table[12][25] = c_less_than;
-	priority_table[12][26] = c_less_than;
-	priority_table[13][10] = c_less_than;
-	priority_table[13][11] = c_less_than;
-	priority_table[13][12] = c_less_than;
-	priority_table[13][13] = c_less_than;
-	priority_table[13][25] = c_less_than;
-	priority_table[13][26] = c_less_than;
-	priority_table[15][25] = c_less_than;
-	priority_table[15][26] = c_less_than;
-	priority_table[22][25] = c_less_than;
-	priority_table[22][26] = c_less_than;
-	for (int64_t i = 1; i < 27; ++i)
-	{
-		priority_table[27][i] = c_less_than;
-	}
-	// > : 67 + 27 + 26 items
-	priority_table[0][14] = c_greater_than;
-	priority_table[2][14] = c_greater_than;
-	priority_table[3][3] = c_greater_than;
-	priority_table[3][4] = c_greater_than;
-	priority_table[3][9] = c_greater_than;
-	priority_table[3][14] = c_greater_than;
-	priority_table[4][3] = c_greater_than;
-	priority_table[4][4] = c_greater_than;
-	priority_table[4][9] = c_greater_than;
-	priority_table[4][14] = c_greater_than;
-	priority_table[5][3] = c_greater_than;
-	priority_table[5][4] = c_greater_than;
-	priority_table[5][5] = c_greater_than;
-	priority_table[5][6] = c_greater_than;
-	priority_table[5][7] = c_greater_than;
-	priority_table[5][9] = c_greater_than;
-	priority_table[5][14] = c_greater_than;
-	priority_table[6][3] = c_greater_than;
-	priority_table[6][4] = c_greater_than;
-	priority_table[6][5] = c_greater_than;
-	priority_table[6][6] = c_greater_than;
-	priority_table[6][7] = c_greater_than;
-	priority_table[6][9] = c_greater_than;
-	priority_table[6][14] = c_greater_than;
-	priority_table[7][3] = c_greater_than;
-	priority_table[7][4] = c_greater_than;
-	priority_table[7][5] = c_greater_than;
-	priority_table[7][6] = c_greater_than;
-	priority_table[7][7] = c_greater_than;
-	priority_table[7][9] = c_greater_than;
-	priority_table[7][14] = c_greater_than;
-	priority_table[9][0] = c_greater_than;
-	priority_table[9][3] = c_greater_than;
-	priority_table[9][4] = c_greater_than;
-	priority_table[9][5] = c_greater_than;
-	priority_table[9][6] = c_greater_than;
-	priority_table[9][7] = c_greater_than;
-	priority_table[9][9] = c_greater_than;
-	priority_table[9][14] = c_greater_than;
-	priority_table[10][9] = c_greater_than;
-	priority_table[11][9] = c_greater_than;
-	priority_table[12][9] = c_greater_than;
-	priority_table[13][9] = c_greater_than;
-	priority_table[15][9] = c_greater_than;
-	priority_table[15][14] = c_greater_than;
-	priority_table[25][3] = c_greater_than;
-	priority_table[25][4] = c_greater_than;
-	priority_table[25][5] = c_greater_than;
-	priority_table[25][6] = c_greater_than;
-	priority_table[25][7] = c_greater_than;
-	priority_table[25][9] = c_greater_than;
-	priority_table[25][10] = c_greater_than;
-	priority_table[25][11] = c_greater_than;
-	priority_table[25][12] = c_greater_than;
-	priority_table[25][14] = c_greater_than;
-	priority_table[25][15] = c_greater_than;
-	priority_table[26][3] = c_greater_than;
-	priority_table[26][4] = c_greater_than;
-	priority_table[26][5] = c_greater_than;
-	priority_table[26][6] = c_greater_than;
-	priority_table[26][7] = c_greater_than;
-	priority_table[26][9] = c_greater_than;
-	priority_table[26][10] = c_greater_than;
-	priority_table[26][11] = c_greater_than;
-	priority_table[26][12] = c_greater_than;
-	priority_table[26][14] = c_greater_than;
-	priority_table[26][15] = c_greater_than;
-	for (int64_t i = 1; i < 27; ++i)
-	{
-		priority_table[14][i] = c_greater_than;
-		if (i != 20)
-		{
-			priority_table[17][i] = c_greater_than;
-		}
-	}
+	// The precedence and production tables are static. See "grammar_table.h".
 #ifdef TEST_BLOCK_6
 	// test block
 	{
+		const char relation_char[4] = { 'u', '<', '=', '>' };
 		printf("----------  test block #6 : BEGIN ----------\n\n");
 		printf("# priority table: BEGIN #\n\n");
 		printf("   ");
@@ -1627,13 +2020,13 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 			printf("%02I64d  ", i);
 			for (int64_t j = 0; j < 27; ++j)
 			{
-				if ('u' == priority_table[i][j])
+				if (GrammarTable::c_undefined_ == GrammarTable::s_GetRelation(i, j))
 				{
-					printf("   ", priority_table[i][j]);
+					printf("   ");
 				}
 				else
 				{
-					printf("%c  ", priority_table[i][j]);
+					printf("%c  ", relation_char[GrammarTable::s_GetRelation(i, j)]);
 				}
 			}
 			printf("\n");
@@ -1643,142 +2036,17 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 		system("PAUSE");
 	}
 #endif
-	std::vector<ParserItem *> parser_table;
-	ParserItem * pi_p = NULL;
-	for (int64_t i = 0; i < 25; ++i)
-	{
-		parser_table.push_back(pi_p);
-		parser_table[parser_table.size() - 1] = ParserItem::s_Malloc();
-		if (NULL == parser_table[parser_table.size() - 1])
-		{
-			error_p->major_no_ = 4;
-			error_p->minor_no_ = 4;
-			return -1;
-		}
-	}
-	// 0
-	parser_table[0]->right.push_back(ParserItem::c_vn_);
-	parser_table[0]->right.push_back(14);
-	// 1
-	parser_table[1]->right.push_back(19);
-	parser_table[1]->right.push_back(8);
-	parser_table[1]->right.push_back(ParserItem::c_vn_);
-	parser_table[1]->right.push_back(9);
-	parser_table[1]->right.push_back(16);
-	parser_table[1]->right.push_back(17);
-	// 2
-	parser_table[2]->right.push_back(19);
-	parser_table[2]->right.push_back(8);
-	parser_table[2]->right.push_back(ParserItem::c_vn_);
-	parser_table[2]->right.push_back(9);
-	parser_table[2]->right.push_back(16);
-	parser_table[2]->right.push_back(17);
-	parser_table[2]->right.push_back(20);
-	parser_table[2]->right.push_back(16);
-	parser_table[2]->right.push_back(17);
-	// 3
-	parser_table[3]->right.push_back(21);
-	parser_table[3]->right.push_back(8);
-	parser_table[3]->right.push_back(ParserItem::c_vn_);
-	parser_table[3]->right.push_back(9);
-	parser_table[3]->right.push_back(16);
-	parser_table[3]->right.push_back(17);
-	// 4
-	parser_table[4]->right.push_back(22);
-	parser_table[4]->right.push_back(ParserItem::c_vn_);
-	parser_table[4]->right.push_back(14);
-	// 5
-	parser_table[5]->right.push_back(23);
-	parser_table[5]->right.push_back(1);
-	parser_table[5]->right.push_back(26);
-	parser_table[5]->right.push_back(1);
-	parser_table[5]->right.push_back(14);
-	// 6
-	parser_table[6]->right.push_back(24);
-	parser_table[6]->right.push_back(1);
-	parser_table[6]->right.push_back(26);
-	parser_table[6]->right.push_back(1);
-	parser_table[6]->right.push_back(14);
-	// 7
-	parser_table[7]->right.push_back(26);
-	parser_table[7]->right.push_back(2);
-	parser_table[7]->right.push_back(ParserItem::c_vn_);
-	// 8
-	parser_table[8]->right.push_back(26);
-	parser_table[8]->right.push_back(2);
-	parser_table[8]->right.push_back(0);
-	parser_table[8]->right.push_back(ParserItem::c_vn_);
-	parser_table[8]->right.push_back(0);
-	// 9
-	parser_table[9]->right.push_back(ParserItem::c_vn_);
-	parser_table[9]->right.push_back(3);
-	parser_table[9]->right.push_back(ParserItem::c_vn_);
-	// 10
-	parser_table[10]->right.push_back(ParserItem::c_vn_);
-	parser_table[10]->right.push_back(4);
-	parser_table[10]->right.push_back(ParserItem::c_vn_);
-	// 11
-	parser_table[11]->right.push_back(ParserItem::c_vn_);
-	parser_table[11]->right.push_back(5);
-	parser_table[11]->right.push_back(ParserItem::c_vn_);
-	// 12
-	parser_table[12]->right.push_back(ParserItem::c_vn_);
-	parser_table[12]->right.push_back(6);
-	parser_table[12]->right.push_back(ParserItem::c_vn_);
-	// 13
-	parser_table[13]->right.push_back(ParserItem::c_vn_);
-	parser_table[13]->right.push_back(7);
-	parser_table[13]->right.push_back(ParserItem::c_vn_);
-	// 14
-	parser_table[14]->right.push_back(8);
-	parser_table[14]->right.push_back(ParserItem::c_vn_);
-	parser_table[14]->right.push_back(9);
-	// 15
-	parser_table[15]->right.push_back(25);
-	// 16
-	parser_table[16]->right.push_back(26);
-	// 17
-	parser_table[17]->right.push_back(18);
-	parser_table[17]->right.push_back(26);
-	// 18
-	parser_table[18]->right.push_back(26);
-	parser_table[18]->right.push_back(8);
-	parser_table[18]->right.push_back(ParserItem::c_vn_);
-	parser_table[18]->right.push_back(9);
-	// 19
-	parser_table[19]->right.push_back(26);
-	parser_table[19]->right.push_back(8);
-	parser_table[19]->right.push_back(9);
-	// 20
-	parser_table[20]->right.push_back(ParserItem::c_vn_);
-	parser_table[20]->right.push_back(15);
-	parser_table[20]->right.push_back(ParserItem::c_vn_);
-	// 21
-	parser_table[21]->right.push_back(ParserItem::c_vn_);
-	parser_table[21]->right.push_back(10);
-	parser_table[21]->right.push_back(ParserItem::c_vn_);
-	// 22
-	parser_table[22]->right.push_back(ParserItem::c_vn_);
-	parser_table[22]->right.push_back(11);
-	parser_table[22]->right.push_back(ParserItem::c_vn_);
-	// 23
-	parser_table[23]->right.push_back(ParserItem::c_vn_);
-	parser_table[23]->right.push_back(12);
-	parser_table[23]->right.push_back(ParserItem::c_vn_);
-	// 24
-	parser_table[24]->right.push_back(13);
-	parser_table[24]->right.push_back(ParserItem::c_vn_);
 #ifdef TEST_BLOCK_7
 	// test block
 	{
 		printf("----------  test block #7 : BEGIN ----------\n\n");
 		printf("# parser: BEGIN #\n\n");
-		for (int64_t i = 0; i < parser_table.size(); ++i)
+		for (int64_t i = 0; i < GrammarTable::c_production_number_; ++i)
 		{
-			printf("[% 3I64d] % 3I64d ---> ", i, parser_table[i]->left);
-			for (int64_t j = 0; j < parser_table[i]->right.size(); ++j)
+			printf("[% 3I64d] % 3I64d ---> ", i, ParserItem::c_vn_);
+			for (int64_t j = 0; j < GrammarTable::s_right_length_table_[i]; ++j)
 			{
-				printf("% 3I64d ", parser_table[i]->right[j]);
+				printf("% 3I64d ", GrammarTable::s_right_table_[i][j]);
 			}
 			printf("\n");
 		}
@@ -1787,8 +2055,121 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 		system("PAUSE");
 	}
 #endif
+	// Errors without a word are shown just behind the block.
+	error_p->location_ = block_tree_p->end_table_[block_p->id_] + 1 < source_file_p->content_size_ ? block_tree_p->end_table_[block_p->id_] + 1 : source_file_p->content_size_ - 1;
+	// state shared by the driver and the semantic actions
+	ParserState state;
+	state.source_file_ = source_file_p;
+	state.error_ = error_p;
+	state.block_ = block_p;
+	state.function_table_ = function_table_p;
+	state.block_tree_ = block_tree_p;
+	state.symbol_table_ = symbol_table_p;
+	// [block_p->name_in_]:
+	if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, CodeItem::s_GetLabel(block_p->id_, CodeItem::c_in_label_)))
+	{
+		// error
+		error_p->major_no_ = 4;
+		error_p->minor_no_ = 4;
+		return -1;
+	}
+	if (block_p->token_stream.size_ > 0)
+	{
+		if (ParserState::c_pratt_engine_ == engine)
+		{
+			if (-1 == ParseBlock_Pratt(&state))
+			{
+				return -1;
+			}
+		}
+		else
+		{
+			if (-1 == ParseBlock_Precedence(&state, 0))
+			{
+				return -1;
+			}
+		}
+	}
+	// JMP [block_p->name_out_]
+	if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, CodeItem::s_GetLabel(block_p->id_, CodeItem::c_out_label_)))
+	{
+		// error
+		error_p->major_no_ = 4;
+		error_p->minor_no_ = 4;
+		return -1;
+	}
+	return 1;
+}
+
+int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)
+{
+	// Blocks are parsed on the work-stealing pool, and a block is ready after its parent, whose variables it may use. Blocks are numbered in order of "{", so a parent is before its children, and the error reported is the first one in order, as if they were parsed one by one.
+	if (NULL == source_file_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"source_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == function_table_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
+	}
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	if (NULL == symbol_table_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"symbol_table_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlockInParallel(SourceFile * source_file_p, Error * error_p, std::vector<FunctionItem *> * function_table_p, BlockTree * block_tree_p, SymbolTable * symbol_table_p, int64_t engine, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	std::vector<int64_t> root_table;
+	for (int64_t i = 0; i < block_tree_p->size_; ++i)
+	{
+		if (BlockTree::c_none_ == block_tree_p->parent_table_[i])
+		{
+			root_table.push_back(i);
+		}
+	}
+	FirstError first_error(block_tree_p->size_);
+	thread_pool_p->ParallelTree(root_table, [&](int64_t block, std::vector<int64_t> * ready_p)
+	{
+		Error error;
+		// The children of a skipped or failed block are after it, and they are skipped too.
+		if (first_error.IsSkipped(block))
+		{
+			return;
+		}
+		if (-1 == ParseBlock(source_file_p, &error, block_tree_p->block_table_[block], function_table_p, block_tree_p, symbol_table_p, engine))
+		{
+			first_error.Fail(block, &error);
+			return;
+		}
+		for (int64_t child = block_tree_p->first_child_table_[block]; BlockTree::c_none_ != child; child = block_tree_p->next_sibling_table_[child])
+		{
+			ready_p->push_back(child);
+		}
+	});
+	return first_error.Report(error_p);
+}
+
+int64_t ParseBlock_Precedence(ParserState * state_p, int64_t word)
+{
+	// operator-precedence driver: Shift and reduce by the relation table from "word" (the beginning of a statement, where the stack is empty) to the end of the block, and call the semantic action of each reduction.
+	if (NULL == state_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_Precedence(ParserState * state_p, int64_t word)\" says: Invalid parameter \"state_p\".");
+	}
 	// symbol stack
 	std::vector<int64_t> symbol_stack;
+	std::vector<int64_t> terminal_stack; // indexes of terminal symbols in "symbol_stack"
+	std::vector<int64_t> value_stack; // first word of each symbol in "symbol_stack" (parallel to it)
+	int64_t phrase_word[GrammarTable::c_max_right_length_]; // "value_stack" of the phrase to reduct
 	int64_t stack_top_vt;
 	int64_t next_vt;
 	int64_t vt_index_1;
@@ -1798,106 +2179,57 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 	int64_t phrase_length;
 	int64_t selected_phrase_index;
 	// tag
-	bool matched;
 	bool end_immediate = false;
-	bool function_call;
-	// word
-	Word * word_p;
-	Word * word_previous_p;
-	Word * temp;
-	// Block
-	Block * blk_p;
-	// register
-	char * rc1 = "RC1";
-	bool rc1_lock = false;
-	char * rc2 = "RC2";
-	bool rc2_lock = false;
-	char * rc3 = "RC3";
-	bool rc3_lock = false;
-	char * rl = "RL";
-	// constant;
-	char * constant;
-	// variable
-	char * variable_name = NULL;
-	char * variable_global_name = NULL;
-	bool variable_defined;
-	// function
-	char * function_name;
-	bool function_defined;
-	// parameter
-	char * parameter_name = NULL;
-	// label
-	char label_1[1024];
-	char label_2[1024];
-	char * label_block_1_in = NULL;
-	char * label_block_1_out = NULL;
-	char * label_block_2_in = NULL;
-	char * label_block_2_out = NULL;
+	SourceFile * source_file_p = state_p->source_file_;
+	Error * error_p = state_p->error_;
+	// token: "word" is the index of the next token, and "word - 1" is the index of the previous one.
+	TokenStream * token_stream_p = &(state_p->block_->token_stream);
 	// prioritized operators algorithm
-	// [block_p->name_in_]:
-	if (-1 == GenerateIntermediate(&(block_p->intermediate), block_p->name_in_, NULL, NULL, NULL))
-	{
-		// error
-		error_p->major_no_ = 4;
-		error_p->minor_no_ = 4;
-		return -1;
-	}
-	word_p = block_p->word_header.next_;
-	word_previous_p = &(block_p->word_header);
-	if (NULL == word_p)
-	{
-		// JMP [block_p->name_out_]
-		if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, block_p->name_out_))
-		{
-			// error
-			error_p->major_no_ = 4;
-			error_p->minor_no_ = 4;
-			return -1;
-		}
-		return 1;
-	}
 	// push '@'
 	symbol_stack.push_back(27);
+	terminal_stack.push_back(0);
+	value_stack.push_back(-1);
 	while (false == end_immediate)
 	{
 		// step 1: read symbol
-		if (word_p != NULL)
+		if (word < token_stream_p->size_)
 		{
-			for (int64_t i = 0; i < symbol_stack.size(); ++i)
-			{
-				if (symbol_stack[i] >= 0)
-				{
-					stack_top_vt = symbol_stack[i];
-				}
-			}
-			next_vt = ParseBlock_GetSymbol(word_p);
-			while (priority_table[stack_top_vt][next_vt] != '>')
+			stack_top_vt = symbol_stack[terminal_stack.back()];
+			next_vt = ParseBlock_GetSymbol(token_stream_p, word);
+			while (GrammarTable::s_GetRelation(stack_top_vt, next_vt) != GrammarTable::c_greater_than_)
 			{
-				if (priority_table[stack_top_vt][next_vt] == 'u')
+				if (GrammarTable::s_GetRelation(stack_top_vt, next_vt) == GrammarTable::c_undefined_)
 				{
 					// error
 					error_p->major_no_ = 4;
 					error_p->minor_no_ = 1;
-					if (NULL != word_p)
+					if (word < token_stream_p->size_)
 					{
-						source_file_p->JumpTo(word_p->source_file_index_);
+						error_p->location_ = token_stream_p->location_table_[word];
 					}
 					return -1;
 				}
+				if (word >= token_stream_p->size_)
+				{
+					// error: The block ends while shifting.
+					error_p->major_no_ = 4;
+					error_p->minor_no_ = 1;
+					return -1;
+				}
 				stack_top_vt = next_vt;
+				terminal_stack.push_back(symbol_stack.size());
 				symbol_stack.push_back(stack_top_vt);
-				word_p = word_p->next_;
-				word_previous_p = word_previous_p->next_;
-				if (word_p != NULL)
+				value_stack.push_back(word);
+				word += 1;
+				if (word < token_stream_p->size_)
 				{
-					next_vt = ParseBlock_GetSymbol(word_p);
+					next_vt = ParseBlock_GetSymbol(token_stream_p, word);
 				}
 			}
 		}
-		// step 2: locate leftmost prime phrase
+		// step 2: locate leftmost prime phrase ("vt_index_1" and "vt_index_2" are indexes in "terminal_stack".)
 		// Tips: symbol_stack[0] == 27
-		for (vt_index_2 = symbol_stack.size() - 1; ParserItem::c_vn_ == symbol_stack[vt_index_2]; --vt_index_2)
-			;
+		vt_index_2 = terminal_stack.size() - 1;
 		while (true)
 		{
 			if (0 == vt_index_2)
@@ -1905,9 +2237,8 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 				end_immediate = true;
 				break;
 			}
-			for (vt_index_1 = vt_index_2 - 1; ParserItem::c_vn_ == symbol_stack[vt_index_1]; --vt_index_1)
-				;
-			if ('<' == priority_table[symbol_stack[vt_index_1]][symbol_stack[vt_index_2]])
+			vt_index_1 = vt_index_2 - 1;
+			if (GrammarTable::c_less_than_ == GrammarTable::s_GetRelation(symbol_stack[terminal_stack[vt_index_1]], symbol_stack[terminal_stack[vt_index_2]]))
 			{
 				break;
 			}
@@ -1917,1440 +2248,1952 @@ int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p,
 		{
 			break;
 		}
-		phrase_beginning_index = vt_index_1 + 1;
+		phrase_beginning_index = terminal_stack[vt_index_1] + 1;
 		phrase_end_index = symbol_stack.size() - 1;
 		phrase_length = phrase_end_index - phrase_beginning_index + 1;
-		// step 3: select a parser to reduct
-		for (int64_t i = 0; i < 25; ++i)
+		// step 3: select a parser to reduct (by the signature of the phrase)
+		selected_phrase_index = GrammarTable::s_SearchProduction(&(symbol_stack[phrase_beginning_index]), phrase_length);
+		if (-1 == selected_phrase_index)
 		{
-			matched = false;
-			if (parser_table[i]->right.size() == phrase_length)
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 1;
+			if (word < token_stream_p->size_)
 			{
-				matched = true;
-				for (int64_t j = 0; j < phrase_length; ++j)
-				{
-					if (parser_table[i]->right[j] != symbol_stack[phrase_beginning_index + j])
-					{
-						matched = false;
-						break;
-					}
-				}
-			}
-			if (matched)
-			{
-				selected_phrase_index = i;
-				break;
+				error_p->location_ = token_stream_p->location_table_[word];
 			}
+			return -1;
 		}
-		if (false == matched)
+		// pop: Words of the phrase are kept for semantic processing.
+		for (int64_t i = 0; i < phrase_length; ++i)
 		{
-			// error
-			error_p->major_no_ = 4;
-			error_p->minor_no_ = 1;
-			if (NULL != word_p)
-			{
-				source_file_p->JumpTo(word_p->source_file_index_);
-			}
-			return -1;
+			phrase_word[i] = value_stack[phrase_beginning_index + i];
 		}
-		// pop
 		for (int64_t i = 0; i < phrase_length; ++i)
 		{
 			symbol_stack.pop_back();
+			value_stack.pop_back();
 		}
+		terminal_stack.resize(vt_index_1 + 1);
 		// push
 		if (selected_phrase_index >= 7)
 		{
 			symbol_stack.push_back(ParserItem::c_vn_);
+			value_stack.push_back(phrase_word[0]);
 		}
 		// step 4: semantic processing
-		switch (selected_phrase_index)
+		if (-1 == ParseBlock_Reduce(state_p, selected_phrase_index, phrase_word, word))
 		{
-		case 0:
-			// none
-			break;
-		case 1:
-			// label block 1
-			for (int64_t i = 0; i < block_table->size(); ++i)
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int64_t ParseBlock_Reduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word)
+{
+	// semantic action of a production: "phrase_word" keeps the first word of each symbol of the phrase, and "word" is the index of the next token.
+	if (NULL == state_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_Reduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word)\" says: Invalid parameter \"state_p\".");
+	}
+	if (NULL == phrase_word)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_Reduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word)\" says: Invalid parameter \"phrase_word\".");
+	}
+	SourceFile * source_file_p = state_p->source_file_;
+	Error * error_p = state_p->error_;
+	Block * block_p = state_p->block_;
+	std::vector<FunctionItem *> * function_table_p = state_p->function_table_;
+	BlockTree * block_tree_p = state_p->block_tree_;
+	SymbolTable * symbol_table_p = state_p->symbol_table_;
+	// tag
+	bool function_call;
+	// token
+	TokenStream * token_stream_p = &(block_p->token_stream);
+	char text[TokenStream::c_text_size_];
+	// Block
+	int64_t blk;
+	// register
+	int64_t rc1 = CodeItem::c_rc1_;
+	int64_t rc2 = CodeItem::c_rc2_;
+	int64_t rc3 = CodeItem::c_rc3_;
+	int64_t rl = CodeItem::c_rl_;
+	// constant: an immediate, or the word itself if it is out of 64-bit range
+	int64_t constant_kind;
+	int64_t constant;
+	// variable
+	int32_t variable_id;
+	const char * variable_name = NULL;
+	int32_t variable;
+	// function
+	int32_t function_id;
+	bool function_defined;
+	// parameter
+	int64_t parameter_kind;
+	int64_t parameter;
+	// label
+	int64_t label_1;
+	int64_t label_2;
+	switch (production)
+	{
+	case 0:
+		// none
+		break;
+	case 1:
+		// label block 1
+		blk = block_tree_p->SearchByEnd(token_stream_p->location_table_[phrase_word[5]]);
+		if (BlockTree::c_none_ != blk)
+		{
+			state_p->label_block_1_in_ = CodeItem::s_GetLabel(blk, CodeItem::c_in_label_);
+			state_p->label_block_1_out_ = CodeItem::s_GetLabel(blk, CodeItem::c_out_label_);
+		}
+		// label
+		label_1 = block_p->GenerateLabel();
+		// CMP RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JE [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_je_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [state_p->label_block_1_in_]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_in_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_in_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [state_p->label_block_1_out_]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_out_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_out_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 2:
+		// label block 1
+		blk = block_tree_p->SearchByEnd(token_stream_p->location_table_[phrase_word[5]]);
+		if (BlockTree::c_none_ != blk)
+		{
+			state_p->label_block_1_in_ = CodeItem::s_GetLabel(blk, CodeItem::c_in_label_);
+			state_p->label_block_1_out_ = CodeItem::s_GetLabel(blk, CodeItem::c_out_label_);
+		}
+		// label block 2
+		blk = block_tree_p->SearchByEnd(token_stream_p->location_table_[phrase_word[8]]);
+		if (BlockTree::c_none_ != blk)
+		{
+			state_p->label_block_2_in_ = CodeItem::s_GetLabel(blk, CodeItem::c_in_label_);
+			state_p->label_block_2_out_ = CodeItem::s_GetLabel(blk, CodeItem::c_out_label_);
+		}
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// CMP RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JE [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_je_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [state_p->label_block_1_in_]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_in_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_in_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [state_p->label_block_1_out_]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_out_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_out_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [state_p->label_block_2_in_]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, -1 == state_p->label_block_2_in_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_2_in_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [state_p->label_block_2_out_]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, -1 == state_p->label_block_2_out_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_2_out_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 3:
+		// label block 1
+		blk = block_tree_p->SearchByEnd(token_stream_p->location_table_[phrase_word[5]]);
+		if (BlockTree::c_none_ != blk)
+		{
+			state_p->label_block_1_in_ = CodeItem::s_GetLabel(blk, CodeItem::c_in_label_);
+			state_p->label_block_1_out_ = CodeItem::s_GetLabel(blk, CodeItem::c_out_label_);
+		}
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// CMP RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JE [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_je_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [state_p->label_block_1_in_]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_in_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_in_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [state_p->label_block_1_out_]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, -1 == state_p->label_block_1_out_ ? CodeItem::c_none_ : CodeItem::c_label_id_, state_p->label_block_1_out_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 4:
+		// none
+		/*
+		// RET RCx
+		if (true == state_p->rc3_lock_)
+		{
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_ret_, CodeItem::c_none_, -1, CodeItem::c_register_, rc3))
+		{
+		// error
+		}
+		state_p->rc3_lock_ = false;
+		}
+		else if (true == state_p->rc2_lock_)
+		{
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_ret_, CodeItem::c_none_, -1, CodeItem::c_register_, rc2))
+		{
+		// error
+		}
+		state_p->rc2_lock_ = false;
+		}
+		else
+		{
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_ret_, CodeItem::c_none_, -1, CodeItem::c_register_, rc1))
+		{
+		// error
+		}
+		state_p->rc1_lock_ = false;
+		}
+		*/
+		break;
+	case 5:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[2]];
+		// search variable define in block and its ancestor
+		variable = symbol_table_p->Search(variable_id, block_p->id_, false);
+		// no found
+		if (-1 == variable)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 2;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// INPUT [variable] RC1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_input_, CodeItem::c_variable_, variable, CodeItem::c_none_, -1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 6:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[2]];
+		// search variable define in block and its ancestor
+		variable = symbol_table_p->Search(variable_id, block_p->id_, false);
+		// no found
+		if (-1 == variable)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 2;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// OUTPUT [variable] RC1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_output_, CodeItem::c_none_, -1, CodeItem::c_variable_, variable))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 7:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[0]];
+		// search variable define in block and its ancestor
+		variable = symbol_table_p->Search(variable_id, block_p->id_, false);
+		// no found
+		if (-1 == variable)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 2;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// MOV [variable] RC1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_variable_, variable, CodeItem::c_register_, rc1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		state_p->rc1_lock_ = false;
+		break;
+	case 8:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[0]];
+		// search variable define in block and its ancestor
+		variable = symbol_table_p->Search(variable_id, block_p->id_, false);
+		// no found
+		if (-1 == variable)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 2;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// MOV [variable] RTV
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_variable_, variable, CodeItem::c_register_, CodeItem::c_rtv_))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 9:
+		// ADD Rx Ry
+		if (state_p->rc2_lock_ && state_p->rc3_lock_)
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_add_, CodeItem::c_register_, rc2, CodeItem::c_register_, rc3))
 			{
-				if ((*block_table)[i]->end_ == word_previous_p->source_file_index_)
-				{
-					label_block_1_in = (*block_table)[i]->name_in_;
-					label_block_1_out = (*block_table)[i]->name_out_;
-				}
+				// error
+				error_p->major_no_ = 4;
+				error_p->minor_no_ = 4;
+				return -1;
 			}
-			// label
-			block_p->GeneratLabelName(label_1);
-			// CMP RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rl, "0"))
+			state_p->rc3_lock_ = false;
+		}
+		else
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_add_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// JE [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JE", NULL, label_1))
+			state_p->rc2_lock_ = false;
+		}
+		break;
+	case 10:
+		// SUB Rx Ry
+		if (state_p->rc2_lock_ && state_p->rc3_lock_)
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_sub_, CodeItem::c_register_, rc2, CodeItem::c_register_, rc3))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// JMP [label_block_1_in]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_block_1_in))
+			state_p->rc3_lock_ = false;
+		}
+		else
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_sub_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// [label_block_1_out]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_block_1_out, NULL, NULL, NULL))
+			state_p->rc2_lock_ = false;
+		}
+		break;
+	case 11:
+		// MUL Rx Ry
+		if (state_p->rc2_lock_ && state_p->rc3_lock_)
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mul_, CodeItem::c_register_, rc2, CodeItem::c_register_, rc3))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
+			state_p->rc3_lock_ = false;
+		}
+		else
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mul_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			break;
-		case 2:
-			// label block 1
-			for (int64_t i = 0; i < block_table->size(); ++i)
-			{
-				if ((*block_table)[i]->end_ == word_previous_p->previous_->previous_->previous_->source_file_index_)
-				{
-					label_block_1_in = (*block_table)[i]->name_in_;
-					label_block_1_out = (*block_table)[i]->name_out_;
-				}
-			}
-			// label block 2
-			for (int64_t i = 0; i < block_table->size(); ++i)
-			{
-				if ((*block_table)[i]->end_ == word_previous_p->source_file_index_)
-				{
-					label_block_2_in = (*block_table)[i]->name_in_;
-					label_block_2_out = (*block_table)[i]->name_out_;
-				}
-			}
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// CMP RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JE [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JE", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_block_1_in]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_block_1_in))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_block_1_out]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_block_1_out, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_block_2_in]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_block_2_in))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_block_2_out]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_block_2_out, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			break;
-		case 3:
-			// label block 1
-			for (int64_t i = 0; i < block_table->size(); ++i)
-			{
-				if ((*block_table)[i]->end_ == word_previous_p->source_file_index_)
-				{
-					label_block_1_in = (*block_table)[i]->name_in_;
-					label_block_1_out = (*block_table)[i]->name_out_;
-				}
-			}
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
+			state_p->rc2_lock_ = false;
+		}
+		break;
+	case 12:
+		// DIV Rx Ry
+		if (state_p->rc2_lock_ && state_p->rc3_lock_)
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_div_, CodeItem::c_register_, rc2, CodeItem::c_register_, rc3))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// CMP RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JE [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JE", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_block_1_in]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_block_1_in))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_block_1_out]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_block_1_out, NULL, NULL, NULL))
+			state_p->rc3_lock_ = false;
+		}
+		else
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_div_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
+			state_p->rc2_lock_ = false;
+		}
+		break;
+	case 13:
+		// MOD Rx Ry
+		if (state_p->rc2_lock_ && state_p->rc3_lock_)
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mod_, CodeItem::c_register_, rc2, CodeItem::c_register_, rc3))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
+			state_p->rc3_lock_ = false;
+		}
+		else
+		{
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mod_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			break;
-		case 4:
-			// none
-			/*
-			// RET RCx
-			if (true == rc3_lock)
-			{
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "RET", NULL, rc3))
-			{
-			// error
-			}
-			rc3_lock = false;
-			}
-			else if (true == rc2_lock)
-			{
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "RET", NULL, rc2))
+			state_p->rc2_lock_ = false;
+		}
+		break;
+	case 14:
+		// none
+		break;
+	case 15:
+		// constant
+		if (1 == CodeItem::s_ParseImmediate(token_stream_p->CopyText(phrase_word[0], text), &constant))
+		{
+			constant_kind = CodeItem::c_immediate_;
+		}
+		else
+		{
+			constant_kind = CodeItem::c_word_;
+			constant = phrase_word[0];
+		}
+		// function_call or not
+		if (word - 2 >= 0 && '(' == token_stream_p->GetText(word - 2)[0])
+		{
+			if (word - 3 >= 0 && TokenStream::c_identifier_ == token_stream_p->type_table_[word - 3])
 			{
-			// error
-			}
-			rc2_lock = false;
+				// function call
+				function_call = true;
 			}
 			else
 			{
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "RET", NULL, rc1))
-			{
-			// error
-			}
-			rc1_lock = false;
-			}
-			*/
-			break;
-		case 5:
-			// variable
-			variable_name = word_previous_p->previous_->previous_->content_;
-			variable_defined = false;
-			// search variable define in block and its ancestor
-			blk_p = block_p;
-			while (false == variable_defined)
-			{
-				for (int64_t i = 0; i < blk_p->variable_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->variable_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->variable_table_[i]->global_name_;
-						break;
-					}
-				}
-				if (NULL == blk_p->parent_)
-				{
-					break;
-				}
-				else
-				{
-					blk_p = blk_p->parent_;
-				}
-			}
-			// no found
-			if (false == variable_defined)
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 2;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
-			}
-			// INPUT [variable_global_name] RC1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "INPUT", variable_global_name, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			break;
-		case 6:
-			// variable
-			variable_name = word_previous_p->previous_->previous_->content_;
-			variable_defined = false;
-			// search variable define in block and its ancestor
-			blk_p = block_p;
-			while (false == variable_defined)
-			{
-				for (int64_t i = 0; i < blk_p->variable_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->variable_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->variable_table_[i]->global_name_;
-						break;
-					}
-				}
-				if (NULL == blk_p->parent_)
-				{
-					break;
-				}
-				else
-				{
-					blk_p = blk_p->parent_;
-				}
-			}
-			// no found
-			if (false == variable_defined)
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 2;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
+				// not function call
+				function_call = false;
 			}
-			// OUTPUT [variable_global_name] RC1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "OUTPUT", NULL, variable_global_name))
+		}
+		else
+		{
+			// not function call
+			function_call = false;
+		}
+		if (function_call)
+		{
+			// PARAMETER [constant]
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_parameter_, CodeItem::c_none_, -1, constant_kind, constant))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			break;
-		case 7:
-			// variable
-			for (temp = word_p; true; temp = temp->previous_)
-			{
-				if ('=' == temp->content_[0])
-				{
-					break;
-				}
-			}
-			variable_name = temp->previous_->content_;
-			variable_defined = false;
-			// search variable define in block and its ancestor
-			blk_p = block_p;
-			while (false == variable_defined)
-			{
-				for (int64_t i = 0; i < blk_p->variable_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->variable_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->variable_table_[i]->global_name_;
-						break;
-					}
-				}
-				if (NULL == blk_p->parent_)
-				{
-					break;
-				}
-				else
-				{
-					blk_p = blk_p->parent_;
-				}
-			}
-			// no found
-			if (false == variable_defined)
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 2;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
-			}
-			// search variable define in function parameter
-			if (false == variable_defined)
+		}
+		else
+		{
+			// MOV RCx [constant]
+			if (false == state_p->rc1_lock_)
 			{
-				for (int64_t i = 0; i < blk_p->function_->parameter_table_.size(); ++i)
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc1, constant_kind, constant))
 				{
-					if (0 == strcmp(variable_name, blk_p->function_->parameter_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->function_->parameter_table_[i]->global_name_;
-						break;
-					}
+					// error
+					error_p->major_no_ = 4;
+					error_p->minor_no_ = 4;
+					return -1;
 				}
+				state_p->rc1_lock_ = true;
 			}
-			// MOV [variable_global_name] RC1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", variable_global_name, rc1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			rc1_lock = false;
-			break;
-		case 8:
-			// variable
-			for (temp = word_p; true; temp = temp->previous_)
+			else if (false == state_p->rc2_lock_)
 			{
-				if ('=' == temp->content_[0])
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc2, constant_kind, constant))
 				{
-					break;
+					// error
+					error_p->major_no_ = 4;
+					error_p->minor_no_ = 4;
+					return -1;
 				}
+				state_p->rc2_lock_ = true;
 			}
-			variable_name = temp->previous_->content_;
-			variable_defined = false;
-			// search variable define in block and its ancestor
-			blk_p = block_p;
-			while (false == variable_defined)
+			else
 			{
-				for (int64_t i = 0; i < blk_p->variable_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->variable_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->variable_table_[i]->global_name_;
-						break;
-					}
-				}
-				if (NULL == blk_p->parent_)
-				{
-					break;
-				}
-				else
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc3, constant_kind, constant))
 				{
-					blk_p = blk_p->parent_;
+					// error
+					error_p->major_no_ = 4;
+					error_p->minor_no_ = 4;
+					return -1;
 				}
+				state_p->rc3_lock_ = true;
 			}
-			// no found
-			if (false == variable_defined)
+		}
+		break;
+	case 16:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[0]];
+		// search variable define in block and its ancestor (and function parameter)
+		variable = symbol_table_p->Search(variable_id, block_p->id_, true);
+		// no found
+		if (-1 == variable)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 2;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// function_call or not
+		if (word - 2 >= 0 && '(' == token_stream_p->GetText(word - 2)[0])
+		{
+			if (word - 3 >= 0 && TokenStream::c_identifier_ == token_stream_p->type_table_[word - 3])
 			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 2;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
+				// function call
+				function_call = true;
 			}
-			// search variable define in function parameter
-			if (false == variable_defined)
+			else
 			{
-				for (int64_t i = 0; i < blk_p->function_->parameter_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->function_->parameter_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->function_->parameter_table_[i]->global_name_;
-						break;
-					}
-				}
+				// not function call
+				function_call = false;
 			}
-			// MOV [variable_global_name] RTV
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", variable_global_name, "RTV"))
+		}
+		else
+		{
+			// not function call
+			function_call = false;
+		}
+		if (function_call)
+		{
+			// PARAMETER [variable]
+			if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_parameter_, CodeItem::c_none_, -1, CodeItem::c_variable_, variable))
 			{
 				// error
 				error_p->major_no_ = 4;
 				error_p->minor_no_ = 4;
 				return -1;
 			}
-			break;
-		case 9:
-			// ADD Rx Ry
-			if (rc2_lock && rc3_lock)
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "ADD", rc2, rc3))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc3_lock = false;
-			}
-			else
+		}
+		else
+		{
+			// MOV RCx [variable]
+			if (false == state_p->rc1_lock_)
 			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "ADD", rc1, rc2))
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc1, CodeItem::c_variable_, variable))
 				{
 					// error
 					error_p->major_no_ = 4;
 					error_p->minor_no_ = 4;
 					return -1;
 				}
-				rc2_lock = false;
+				state_p->rc1_lock_ = true;
 			}
-			break;
-		case 10:
-			// SUB Rx Ry
-			if (rc2_lock && rc3_lock)
+			else if (false == state_p->rc2_lock_)
 			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "SUB", rc2, rc3))
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc2, CodeItem::c_variable_, variable))
 				{
 					// error
 					error_p->major_no_ = 4;
 					error_p->minor_no_ = 4;
 					return -1;
 				}
-				rc3_lock = false;
+				state_p->rc2_lock_ = true;
 			}
 			else
 			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "SUB", rc1, rc2))
+				if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rc3, CodeItem::c_variable_, variable))
 				{
 					// error
 					error_p->major_no_ = 4;
 					error_p->minor_no_ = 4;
 					return -1;
 				}
-				rc2_lock = false;
+				state_p->rc3_lock_ = true;
 			}
-			break;
-		case 11:
-			// MUL Rx Ry
-			if (rc2_lock && rc3_lock)
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MUL", rc2, rc3))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc3_lock = false;
-			}
-			else
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MUL", rc1, rc2))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc2_lock = false;
-			}
-			break;
-		case 12:
-			// DIV Rx Ry
-			if (rc2_lock && rc3_lock)
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "DIV", rc2, rc3))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc3_lock = false;
-			}
-			else
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "DIV", rc1, rc2))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc2_lock = false;
-			}
-			break;
-		case 13:
-			// MOD Rx Ry
-			if (rc2_lock && rc3_lock)
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOD", rc2, rc3))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc3_lock = false;
-			}
-			else
-			{
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOD", rc1, rc2))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-				rc2_lock = false;
-			}
-			break;
-		case 14:
-			// none
-			break;
-		case 15:
-			// constant
-			constant = word_p->previous_->content_;
-			// function_call or not
-			if ('(' == word_p->previous_->previous_->content_[0])
-			{
-				if (Word::c_identifier_ == word_p->previous_->previous_->previous_->type_)
-				{
-					// function call
-					function_call = true;
-				}
-				else
-				{
-					// not function call
-					function_call = false;
-				}
-			}
-			else
-			{
-				// not function call
-				function_call = false;
-			}
-			if (function_call)
-			{
-				// PARAMETER [constant]
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "PARAMETER", NULL, constant))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
-			}
-			else
-			{
-				// MOV RCx [constant]
-				if (false == rc1_lock)
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc1, constant))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc1_lock = true;
-				}
-				else if (false == rc2_lock)
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc2, constant))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc2_lock = true;
-				}
-				else
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc3, constant))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc3_lock = true;
-				}
-			}
-			break;
-		case 16:
-			// variable
-			variable_name = word_p->previous_->content_;
-			variable_defined = false;
-			// search variable define in block and its ancestor
-			blk_p = block_p;
-			while (false == variable_defined)
-			{
-				for (int64_t i = 0; i < blk_p->variable_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->variable_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->variable_table_[i]->global_name_;
-						break;
-					}
-				}
-				if (NULL == blk_p->parent_)
-				{
-					break;
-				}
-				else
-				{
-					blk_p = blk_p->parent_;
-				}
-			}
-			// search variable define in function parameter
-			if (false == variable_defined)
-			{
-				for (int64_t i = 0; i < blk_p->function_->parameter_table_.size(); ++i)
-				{
-					if (0 == strcmp(variable_name, blk_p->function_->parameter_table_[i]->name_))
-					{
-						variable_defined = true;
-						variable_global_name = blk_p->function_->parameter_table_[i]->global_name_;
-						break;
-					}
-				}
-			}
-			// no found
-			if (false == variable_defined)
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 2;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
-			}
-			// function_call or not
-			if ('(' == word_p->previous_->previous_->content_[0])
+		}
+		break;
+	case 17:
+		// variable
+		variable_id = token_stream_p->id_table_[phrase_word[1]];
+		variable_name = Interner::s_interner_.GetText(variable_id);
+		// fill variable table in block
+		block_p->variable_table_.push_back(NULL);
+		block_p->variable_table_[block_p->variable_table_.size() - 1] = VariableItem::s_Malloc(&(block_p->arena));
+		if (NULL == block_p->variable_table_[block_p->variable_table_.size() - 1])
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		block_p->variable_table_[block_p->variable_table_.size() - 1]->type_ = VariableItem::c_int_;
+		block_p->variable_table_[block_p->variable_table_.size() - 1]->SetName(variable_name, &(block_p->arena));
+		block_p->variable_table_[block_p->variable_table_.size() - 1]->name_id_ = variable_id;
+		block_p->variable_table_[block_p->variable_table_.size() - 1]->block_ = block_p->id_;
+		symbol_table_p->Insert(variable_id, block_p->id_, block_p->variable_table_[block_p->variable_table_.size() - 1], false);
+		break;
+	case 18:
+	case 19:
+		// function
+		function_id = token_stream_p->id_table_[phrase_word[0]];
+		function_defined = false;
+		for (int64_t i = 0; false == function_defined && i < function_table_p->size(); ++i)
+		{
+			if (function_id == (*function_table_p)[i]->name_id_)
 			{
-				if (Word::c_identifier_ == word_p->previous_->previous_->previous_->type_)
-				{
-					// function call
-					function_call = true;
-				}
-				else
-				{
-					// not function call
-					function_call = false;
-				}
+				function_defined = true;
 			}
-			else
+		}
+		// no found
+		if (false == function_defined)
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 3;
+			error_p->location_ = token_stream_p->location_table_[word - 1];
+			return -1;
+		}
+		// CALL [function_id]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_call_, CodeItem::c_none_, -1, CodeItem::c_function_, function_id))
+		{
+			// error
+		}
+		break;
+	case 20:
+		// parameter
+		if (TokenStream::c_identifier_ == token_stream_p->type_table_[word - 1])
+		{
+			if (state_p->rc3_lock_)
 			{
-				// not function call
-				function_call = false;
+				parameter_kind = CodeItem::c_register_;
+				parameter = CodeItem::c_r3_;
+				state_p->rc3_lock_ = false;
 			}
-			if (function_call)
+			else if (state_p->rc2_lock_)
 			{
-				// PARAMETER [variable_global_name]
-				if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "PARAMETER", NULL, variable_global_name))
-				{
-					// error
-					error_p->major_no_ = 4;
-					error_p->minor_no_ = 4;
-					return -1;
-				}
+				parameter_kind = CodeItem::c_register_;
+				parameter = CodeItem::c_r2_;
+				state_p->rc2_lock_ = false;
 			}
 			else
 			{
-				// MOV RCx [variable_global_name]
-				if (false == rc1_lock)
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc1, variable_global_name))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc1_lock = true;
-				}
-				else if (false == rc2_lock)
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc2, variable_global_name))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc2_lock = true;
-				}
-				else
-				{
-					if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rc3, variable_global_name))
-					{
-						// error
-						error_p->major_no_ = 4;
-						error_p->minor_no_ = 4;
-						return -1;
-					}
-					rc3_lock = true;
-				}
-			}
-			break;
-		case 17:
-			// variable
-			variable_name = word_p->previous_->content_;
-			// fill variable table in block
-			block_p->variable_table_.push_back(NULL);
-			block_p->variable_table_[block_p->variable_table_.size() - 1] = VariableItem::s_Malloc();
-			if (NULL == block_p->variable_table_[block_p->variable_table_.size() - 1])
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			block_p->variable_table_[block_p->variable_table_.size() - 1]->type_ = VariableItem::c_int_;
-			block_p->variable_table_[block_p->variable_table_.size() - 1]->SetName(variable_name);
-			sprintf(VariableItem::s_buffer_, "%s_%s", block_p->name_, variable_name);
-			block_p->variable_table_[block_p->variable_table_.size() - 1]->SetGlobalName(VariableItem::s_buffer_);
-			break;
-		case 18:
-		case 19:
-			// function
-			for (temp = word_p; true; temp = temp->previous_)
-			{
-				if ('(' == temp->content_[0])
-				{
-					break;
-				}
-			}
-			function_name = temp->previous_->content_;
-			function_defined = false;
-			for (int64_t i = 0; false == function_defined && i < function_table_p->size(); ++i)
-			{
-				if (0 == strcmp((*function_table_p)[i]->name_, function_name))
-				{
-					function_defined = true;
-				}
-			}
-			// no found
-			if (false == function_defined)
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 3;
-				source_file_p->JumpTo(word_previous_p->source_file_index_);
-				return -1;
-			}
-			// CALL [function_name]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CALL", NULL, function_name))
-			{
-				// error
+				parameter_kind = CodeItem::c_register_;
+				parameter = CodeItem::c_r1_;
+				state_p->rc1_lock_ = false;
 			}
-			break;
-		case 20:
-			// parameter
-			if (Word::c_identifier_ == word_p->previous_->type_)
+		}
+		else
+		{
+			if (1 == CodeItem::s_ParseImmediate(token_stream_p->CopyText(word - 1, text), &parameter))
 			{
-				if (rc3_lock)
-				{
-					parameter_name = "R3";
-					rc3_lock = false;
-				}
-				else if (rc2_lock)
-				{
-					parameter_name = "R2";
-					rc2_lock = false;
-				}
-				else
-				{
-					parameter_name = "R1";
-					rc1_lock = false;
-				}
+				parameter_kind = CodeItem::c_immediate_;
 			}
 			else
 			{
-				parameter_name = word_p->previous_->content_;
-			}
-			// PARAMETER [parameter_name]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "PARAMETER", NULL, parameter_name))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			break;
-		case 21:
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// CMP RC1 RC2
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rc1, rc2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			rc1_lock = false;
-			rc2_lock = false;
-			// JG [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JG", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
+				parameter_kind = CodeItem::c_word_;
+				parameter = word - 1;
 			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "1"))
+		}
+		// PARAMETER [parameter]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_parameter_, CodeItem::c_none_, -1, parameter_kind, parameter))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 21:
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// CMP RC1 RC2
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		state_p->rc1_lock_ = false;
+		state_p->rc2_lock_ = false;
+		// JG [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jg_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 22:
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// CMP RC1 RC2
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		state_p->rc1_lock_ = false;
+		state_p->rc2_lock_ = false;
+		// JL [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jl_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 23:
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// CMP RC1 RC2
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rc1, CodeItem::c_register_, rc2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		state_p->rc1_lock_ = false;
+		state_p->rc2_lock_ = false;
+		// JE [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_je_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	case 24:
+		// label
+		label_1 = block_p->GenerateLabel();
+		label_2 = block_p->GenerateLabel();
+		// CMP RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_cmp_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JE [label_1]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_je_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 0
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 0))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// JMP [label_2]
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_jmp_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_1]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// MOV RL 1
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_mov_, CodeItem::c_register_, rl, CodeItem::c_immediate_, 1))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		// [label_2]:
+		if (-1 == GenerateIntermediate(&(block_p->intermediate), CodeItem::c_label_, CodeItem::c_none_, -1, CodeItem::c_label_id_, label_2))
+		{
+			// error
+			error_p->major_no_ = 4;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		break;
+	default:
+		throw std::exception("Function \"int64_t ParseBlock_Reduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word)\" says: Invalid parameter \"production\".");
+		break;
+	}
+	return 1;
+}
+
+int64_t ParseBlock_Pratt(ParserState * state_p)
+{
+	// Pratt driver: Statements are parsed top-down and arithmetical expressions by binding power. The semantic action of each production is called with the same words and in the same order as "ParseBlock_Precedence", so the codes are the same.
+	if (NULL == state_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_Pratt(ParserState * state_p)\" says: Invalid parameter \"state_p\".");
+	}
+	Block * block_p = state_p->block_;
+	ParserState statement_state;
+	int64_t statement;
+	int64_t code_number;
+	int64_t variable_number;
+	int64_t location = state_p->error_->location_;
+	int64_t word = 0;
+	while (word < block_p->token_stream.size_)
+	{
+		// The stack of "ParseBlock_Precedence" is empty between statements, and the codes before are the same.
+		statement = word;
+		statement_state = *state_p;
+		code_number = block_p->intermediate.size();
+		variable_number = block_p->variable_table_.size();
+		if (-1 == ParseBlock_PrattStatement(state_p, &word))
+		{
+			// a wrong statement: The rest of the block is parsed again by "ParseBlock_Precedence" from the beginning of the statement, so the error is the same for both engines.
+			*state_p = statement_state;
+			state_p->error_->location_ = location;
+			block_p->intermediate.resize(code_number);
+			block_p->variable_table_.resize(variable_number);
+			return ParseBlock_Precedence(state_p, statement);
+		}
+	}
+	return 1;
+}
+
+int64_t ParseBlock_PrattStatement(ParserState * state_p, int64_t * word_p)
+{
+	int64_t phrase_word[GrammarTable::c_max_right_length_];
+	int64_t symbol = ParseBlock_PrattSymbol(state_p, *word_p);
+	int64_t production;
+	switch (symbol)
+	{
+	case 18:
+		// int i ;
+		phrase_word[0] = *word_p;
+		*word_p += 1;
+		phrase_word[1] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 26))
+		{
+			return -1;
+		}
+		if (-1 == ParseBlock_PrattReduce(state_p, 17, phrase_word, *word_p))
+		{
+			return -1;
+		}
+		break;
+	case 19:
+	case 21:
+		// if ( N ) { } [else { }], while ( N ) { }
+		phrase_word[0] = *word_p;
+		*word_p += 1;
+		phrase_word[1] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 8))
+		{
+			return -1;
+		}
+		phrase_word[2] = *word_p;
+		if (-1 == ParseBlock_PrattRun(state_p, word_p, PrattFrame::c_parenthesis_, 0))
+		{
+			return -1;
+		}
+		phrase_word[3] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 9))
+		{
+			return -1;
+		}
+		phrase_word[4] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 16))
+		{
+			return -1;
+		}
+		phrase_word[5] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 17))
+		{
+			return -1;
+		}
+		production = 19 == symbol ? 1 : 3;
+		if (19 == symbol && 20 == ParseBlock_PrattSymbol(state_p, *word_p))
+		{
+			phrase_word[6] = *word_p;
+			*word_p += 1;
+			phrase_word[7] = *word_p;
+			if (-1 == ParseBlock_PrattExpect(state_p, word_p, 16))
 			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
+			phrase_word[8] = *word_p;
+			if (-1 == ParseBlock_PrattExpect(state_p, word_p, 17))
 			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
 				return -1;
 			}
+			production = 2;
+		}
+		return ParseBlock_PrattReduce(state_p, production, phrase_word, *word_p);
+	case 22:
+		// return N ;
+		phrase_word[0] = *word_p;
+		*word_p += 1;
+		phrase_word[1] = *word_p;
+		if (-1 == ParseBlock_PrattRun(state_p, word_p, PrattFrame::c_operand_, 0))
+		{
+			return -1;
+		}
+		phrase_word[2] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 14))
+		{
+			return -1;
+		}
+		return ParseBlock_PrattReduce(state_p, 4, phrase_word, *word_p);
+	case 23:
+	case 24:
+		// input $$ i $$ ;, output $$ i $$ ;
+		phrase_word[0] = *word_p;
+		*word_p += 1;
+		phrase_word[1] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 1))
+		{
+			return -1;
+		}
+		phrase_word[2] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 26))
+		{
+			return -1;
+		}
+		phrase_word[3] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 1))
+		{
+			return -1;
+		}
+		phrase_word[4] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 14))
+		{
+			return -1;
+		}
+		return ParseBlock_PrattReduce(state_p, 23 == symbol ? 5 : 6, phrase_word, *word_p);
+	default:
+		// expression (assignment, call, etc.)
+		phrase_word[0] = *word_p;
+		if (-1 == ParseBlock_PrattRun(state_p, word_p, PrattFrame::c_expression_, 0))
+		{
+			return -1;
+		}
+		break;
+	}
+	// N ;
+	phrase_word[1] = *word_p;
+	if (-1 == ParseBlock_PrattExpect(state_p, word_p, 14))
+	{
+		return -1;
+	}
+	return ParseBlock_PrattReduce(state_p, 0, phrase_word, *word_p);
+}
+
+int64_t ParseBlock_PrattRun(ParserState * state_p, int64_t * word_p, int64_t rule, int64_t power)
+{
+	// Run "rule" until it returns. Each rule runs on the frame at the top of "state_p->frame_stack_": It returns 0 after pushing the frame of a rule it calls, which is run next, and 1 after popping its own frame.
+	std::vector<PrattFrame> * frame_stack_p = &(state_p->frame_stack_);
+	int64_t bottom = frame_stack_p->size();
+	int64_t result;
+	ParseBlock_PrattPush(state_p, rule, power);
+	while ((int64_t)frame_stack_p->size() > bottom)
+	{
+		switch (frame_stack_p->back().rule_)
+		{
+		case PrattFrame::c_expression_:
+			result = ParseBlock_PrattExpression(state_p, word_p);
 			break;
-		case 22:
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// CMP RC1 RC2
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rc1, rc2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			rc1_lock = false;
-			rc2_lock = false;
-			// JL [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JL", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "1"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
+		case PrattFrame::c_factor_:
+			result = ParseBlock_PrattFactor(state_p, word_p);
 			break;
-		case 23:
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// CMP RC1 RC2
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rc1, rc2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			rc1_lock = false;
-			rc2_lock = false;
-			// JE [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JE", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "0"))
-			{
-				// error
-			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "1"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
+		case PrattFrame::c_parenthesis_:
+			result = ParseBlock_PrattParenthesis(state_p, word_p);
 			break;
-		case 24:
-			// label
-			block_p->GeneratLabelName(label_1);
-			block_p->GeneratLabelName(label_2);
-			// CMP RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "CMP", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JE [label_1]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JE", NULL, label_1))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// MOV RL 0
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "0"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// JMP [label_2]
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, label_2))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
-			}
-			// [label_1]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_1, NULL, NULL, NULL))
+		case PrattFrame::c_operand_:
+			result = ParseBlock_PrattOperand(state_p, word_p);
+			break;
+		case PrattFrame::c_call_:
+			result = ParseBlock_PrattCall(state_p, word_p);
+			break;
+		default:
+			throw std::exception("Function \"int64_t ParseBlock_PrattRun(ParserState * state_p, int64_t * word_p, int64_t rule, int64_t power)\" says: Invalid rule.");
+		}
+		if (-1 == result)
+		{
+			frame_stack_p->resize(bottom);
+			return -1;
+		}
+	}
+	return 1;
+}
+
+void ParseBlock_PrattPush(ParserState * state_p, int64_t rule, int64_t power)
+{
+	// Call a rule: Its frame is pushed, so the frame of the caller may move.
+	state_p->frame_stack_.push_back(PrattFrame());
+	state_p->frame_stack_.back().rule_ = rule;
+	state_p->frame_stack_.back().power_ = power;
+}
+
+int64_t ParseBlock_PrattExpression(ParserState * state_p, int64_t * word_p)
+{
+	// Parse operands and operators binding stronger than "power_": "+" and "-" bind 1, "*", "/" and "%" bind 2, and all of them are left associative.
+	PrattFrame * frame_p = &(state_p->frame_stack_.back());
+	int64_t binding_power;
+	switch (frame_p->step_)
+	{
+	case 0:
+		frame_p->phrase_word_[0] = *word_p;
+		frame_p->step_ = 1;
+		ParseBlock_PrattPush(state_p, PrattFrame::c_factor_, 0);
+		return 0;
+	case 2:
+		// N + N, N - N, N * N, N / N, N % N: productions 9 to 13
+		if (-1 == ParseBlock_PrattReduce(state_p, frame_p->symbol_ + 6, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		break;
+	default:
+		break;
+	}
+	frame_p->symbol_ = ParseBlock_PrattSymbol(state_p, *word_p);
+	if (3 == frame_p->symbol_ || 4 == frame_p->symbol_)
+	{
+		binding_power = 1;
+	}
+	else if (5 == frame_p->symbol_ || 6 == frame_p->symbol_ || 7 == frame_p->symbol_)
+	{
+		binding_power = 2;
+	}
+	else
+	{
+		binding_power = 0;
+	}
+	if (binding_power <= frame_p->power_)
+	{
+		state_p->frame_stack_.pop_back();
+		return 1;
+	}
+	frame_p->phrase_word_[1] = *word_p;
+	*word_p += 1;
+	frame_p->phrase_word_[2] = *word_p;
+	frame_p->step_ = 2;
+	ParseBlock_PrattPush(state_p, PrattFrame::c_expression_, binding_power);
+	return 0;
+}
+
+int64_t ParseBlock_PrattFactor(ParserState * state_p, int64_t * word_p)
+{
+	PrattFrame * frame_p = &(state_p->frame_stack_.back());
+	switch (frame_p->step_)
+	{
+	case 0:
+		switch (ParseBlock_PrattSymbol(state_p, *word_p))
+		{
+		case 25:
+			// const
+			frame_p->phrase_word_[0] = *word_p;
+			*word_p += 1;
+			if (-1 == ParseBlock_PrattReduce(state_p, 15, frame_p->phrase_word_, *word_p))
 			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
 				return -1;
 			}
-			// MOV RL 1
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "MOV", rl, "1"))
-			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
-				return -1;
+			state_p->frame_stack_.pop_back();
+			return 1;
+		case 26:
+			if (2 == ParseBlock_PrattSymbol(state_p, *word_p + 1))
+			{
+				// i = N, i = $ N $
+				frame_p->phrase_word_[0] = *word_p;
+				frame_p->phrase_word_[1] = *word_p + 1;
+				*word_p += 2;
+				frame_p->phrase_word_[2] = *word_p;
+				if (0 == ParseBlock_PrattSymbol(state_p, *word_p))
+				{
+					*word_p += 1;
+					frame_p->phrase_word_[3] = *word_p;
+					frame_p->production_ = 8;
+					frame_p->step_ = 1;
+					ParseBlock_PrattPush(state_p, PrattFrame::c_call_, 0);
+					return 0;
+				}
+				frame_p->production_ = 7;
+				frame_p->step_ = 2;
+				ParseBlock_PrattPush(state_p, PrattFrame::c_expression_, 0);
+				return 0;
 			}
-			// [label_2]:
-			if (-1 == GenerateIntermediate(&(block_p->intermediate), label_2, NULL, NULL, NULL))
+			// the same as an operand
+			frame_p->rule_ = PrattFrame::c_operand_;
+			return 0;
+		case 8:
+			// ( N )
+			frame_p->phrase_word_[0] = *word_p;
+			*word_p += 1;
+			frame_p->phrase_word_[1] = *word_p;
+			frame_p->step_ = 3;
+			ParseBlock_PrattPush(state_p, PrattFrame::c_parenthesis_, 0);
+			return 0;
+		default:
+			return ParseBlock_PrattError(state_p, *word_p, 1);
+		}
+	case 1:
+		// i = $ N $: after the call
+		frame_p->phrase_word_[4] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 0))
+		{
+			return -1;
+		}
+		// Go on as below.
+	case 2:
+		if (-1 == ParseBlock_PrattReduce(state_p, frame_p->production_, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		// An assignment is always the end of the statement.
+		if (ParseBlock_PrattSymbol(state_p, *word_p) != 14)
+		{
+			return ParseBlock_PrattError(state_p, *word_p, 1);
+		}
+		state_p->frame_stack_.pop_back();
+		return 1;
+	default:
+		// ( N ): after the content
+		frame_p->phrase_word_[2] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 9))
+		{
+			return -1;
+		}
+		if (-1 == ParseBlock_PrattReduce(state_p, 14, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		state_p->frame_stack_.pop_back();
+		return 1;
+	}
+}
+
+int64_t ParseBlock_PrattParenthesis(ParserState * state_p, int64_t * word_p)
+{
+	// Parse the content of "( )" (but not ")"): "! N", a relation or a pair of operands, or an arithmetical expression.
+	PrattFrame * frame_p = &(state_p->frame_stack_.back());
+	switch (frame_p->step_)
+	{
+	case 0:
+		frame_p->first_not_ = *word_p;
+		while (13 == ParseBlock_PrattSymbol(state_p, *word_p))
+		{
+			*word_p += 1;
+		}
+		frame_p->not_number_ = *word_p - frame_p->first_not_;
+		frame_p->phrase_word_[0] = *word_p;
+		frame_p->symbol_ = ParseBlock_PrattSymbol(state_p, *word_p + 1);
+		if ((25 == ParseBlock_PrattSymbol(state_p, *word_p) || 26 == ParseBlock_PrattSymbol(state_p, *word_p)) && (10 == frame_p->symbol_ || 11 == frame_p->symbol_ || 12 == frame_p->symbol_ || (15 == frame_p->symbol_ && 0 == frame_p->not_number_)))
+		{
+			// N > N, N < N, N == N, N , N: The left operand is a single word.
+			frame_p->step_ = 1;
+			ParseBlock_PrattPush(state_p, PrattFrame::c_operand_, 0);
+			return 0;
+		}
+		frame_p->step_ = 3;
+		ParseBlock_PrattPush(state_p, 0 == frame_p->not_number_ ? PrattFrame::c_expression_ : PrattFrame::c_operand_, 0);
+		return 0;
+	case 1:
+		frame_p->phrase_word_[1] = *word_p;
+		*word_p += 1;
+		frame_p->phrase_word_[2] = *word_p;
+		frame_p->step_ = 2;
+		ParseBlock_PrattPush(state_p, PrattFrame::c_operand_, 0);
+		return 0;
+	case 2:
+		if (-1 == ParseBlock_PrattReduce(state_p, 15 == frame_p->symbol_ ? 20 : frame_p->symbol_ + 11, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		// Go on as below.
+	default:
+		// ! N: The innermost one is reduced first.
+		for (int64_t i = frame_p->not_number_ - 1; i >= 0; --i)
+		{
+			frame_p->phrase_word_[0] = frame_p->first_not_ + i;
+			frame_p->phrase_word_[1] = frame_p->first_not_ + i + 1;
+			if (-1 == ParseBlock_PrattReduce(state_p, 24, frame_p->phrase_word_, *word_p))
 			{
-				// error
-				error_p->major_no_ = 4;
-				error_p->minor_no_ = 4;
 				return -1;
 			}
-			break;
-		default:
-			throw std::exception("Function \"int64_t ParseBlock(SourceFile * source_file_p, Error * error_p, Block * block_p)\" says: Invalid variable \"selected_phrase_index\".");
-			break;
 		}
+		state_p->frame_stack_.pop_back();
+		return 1;
 	}
-	// JMP [block_p->name_out_]
-	if (-1 == GenerateIntermediate(&(block_p->intermediate), NULL, "JMP", NULL, block_p->name_out_))
+}
+
+int64_t ParseBlock_PrattOperand(ParserState * state_p, int64_t * word_p)
+{
+	// operand of "return", a relation, "," or "!": a constant, a variable or a call
+	PrattFrame * frame_p = &(state_p->frame_stack_.back());
+	switch (ParseBlock_PrattSymbol(state_p, *word_p))
+	{
+	case 25:
+		// const
+		frame_p->phrase_word_[0] = *word_p;
+		*word_p += 1;
+		if (-1 == ParseBlock_PrattReduce(state_p, 15, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		break;
+	case 26:
+		if (8 == ParseBlock_PrattSymbol(state_p, *word_p + 1))
+		{
+			// the same as a call
+			frame_p->rule_ = PrattFrame::c_call_;
+			return 0;
+		}
+		// i
+		frame_p->phrase_word_[0] = *word_p;
+		*word_p += 1;
+		if (-1 == ParseBlock_PrattReduce(state_p, 16, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		break;
+	default:
+		return ParseBlock_PrattError(state_p, *word_p, 1);
+	}
+	state_p->frame_stack_.pop_back();
+	return 1;
+}
+
+int64_t ParseBlock_PrattCall(ParserState * state_p, int64_t * word_p)
+{
+	// i ( N ), i ( )
+	PrattFrame * frame_p = &(state_p->frame_stack_.back());
+	if (0 == frame_p->step_)
+	{
+		frame_p->phrase_word_[0] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 26))
+		{
+			return -1;
+		}
+		frame_p->phrase_word_[1] = *word_p;
+		if (-1 == ParseBlock_PrattExpect(state_p, word_p, 8))
+		{
+			return -1;
+		}
+		frame_p->phrase_word_[2] = *word_p;
+		if (9 != ParseBlock_PrattSymbol(state_p, *word_p))
+		{
+			frame_p->step_ = 1;
+			ParseBlock_PrattPush(state_p, PrattFrame::c_parenthesis_, 0);
+			return 0;
+		}
+		*word_p += 1;
+		if (-1 == ParseBlock_PrattReduce(state_p, 19, frame_p->phrase_word_, *word_p))
+		{
+			return -1;
+		}
+		state_p->frame_stack_.pop_back();
+		return 1;
+	}
+	frame_p->phrase_word_[3] = *word_p;
+	if (-1 == ParseBlock_PrattExpect(state_p, word_p, 9))
+	{
+		return -1;
+	}
+	if (-1 == ParseBlock_PrattReduce(state_p, 18, frame_p->phrase_word_, *word_p))
 	{
-		// error
-		error_p->major_no_ = 4;
-		error_p->minor_no_ = 4;
 		return -1;
 	}
+	state_p->frame_stack_.pop_back();
 	return 1;
 }
 
-int64_t ParseBlock_GetSymbol(Word * word_p)
+int64_t ParseBlock_PrattReduce(ParserState * state_p, int64_t production, int64_t * phrase_word, int64_t word)
 {
-	if (NULL == word_p)
+	// The operator-precedence driver reduces a phrase only when its last terminal symbol is ">" the next one (or at the end of the block), and it finds a syntax error if they have no relation. It is checked here before the semantic action, so both engines reduce the same phrases.
+	int64_t last = GrammarTable::s_right_length_table_[production] - 1;
+	while (ParserItem::c_vn_ == GrammarTable::s_right_table_[production][last])
 	{
-		throw std::exception("Function \"int64_t ParseBlock_GetSymbol(Word * word_p)\" says: Invalid parameter \"word_p\".");
+		last -= 1;
 	}
-	switch (word_p->type_)
+	if (word < state_p->block_->token_stream.size_ && GrammarTable::c_greater_than_ != GrammarTable::s_GetRelation(GrammarTable::s_right_table_[production][last], ParseBlock_PrattSymbol(state_p, word)))
 	{
-	case Word::c_identifier_:
-		return 26;
-	case Word::c_constant_int_:
-		return 25;
-	default:
-		switch (word_p->content_[0])
+		return ParseBlock_PrattError(state_p, word, 1);
+	}
+	return ParseBlock_Reduce(state_p, production, phrase_word, word);
+}
+
+int64_t ParseBlock_PrattSymbol(ParserState * state_p, int64_t word)
+{
+	// terminal symbol of the word, or -1 after the end of the block
+	if (word >= state_p->block_->token_stream.size_)
+	{
+		return -1;
+	}
+	return ParseBlock_GetSymbol(&(state_p->block_->token_stream), word);
+}
+
+int64_t ParseBlock_PrattExpect(ParserState * state_p, int64_t * word_p, int64_t symbol)
+{
+	// Skip the word if it is "symbol", else it is a syntax error.
+	if (ParseBlock_PrattSymbol(state_p, *word_p) != symbol)
+	{
+		return ParseBlock_PrattError(state_p, *word_p, 1);
+	}
+	*word_p += 1;
+	return 1;
+}
+
+int64_t ParseBlock_PrattError(ParserState * state_p, int64_t word, int64_t minor_no)
+{
+	state_p->error_->major_no_ = 4;
+	state_p->error_->minor_no_ = minor_no;
+	if (word < state_p->block_->token_stream.size_)
+	{
+		state_p->error_->location_ = state_p->block_->token_stream.location_table_[word];
+	}
+	return -1;
+}
+
+int64_t ParseBlock_GetSymbol(TokenStream * token_stream_p, int64_t index)
+{
+	if (NULL == token_stream_p)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_GetSymbol(TokenStream * token_stream_p, int64_t index)\" says: Invalid parameter \"token_stream_p\".");
+	}
+	if (index < 0 || index >= token_stream_p->size_)
+	{
+		throw std::exception("Function \"int64_t ParseBlock_GetSymbol(TokenStream * token_stream_p, int64_t index)\" says: Invalid parameter \"index\".");
+	}
+	// The symbol is set in lexical analysis. See function "TokenStream::s_GetSymbol".
+	if (-1 == token_stream_p->symbol_table_[index])
+	{
+		throw std::exception("Function \"int64_t ParseBlock_GetSymbol(TokenStream * token_stream_p, int64_t index)\" says: Invalid word. There is something wrong in function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, BlockTree * block_tree_p, bool is_block, void * pointer)\".");
+	}
+	return token_stream_p->symbol_table_[index];
+}
+
+int64_t GenerateIntermediate(std::vector<CodeItem> * intermediate_p, int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)
+{
+	if (NULL == intermediate_p)
+	{
+		throw std::exception("Function \"int64_t GenerateIntermediate(std::vector<CodeItem> * intermediate_p, int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)\" says: Invalid parameter \"intermediate_p\".");
+	}
+	if (op < 0 || op >= CodeItem::c_op_number_)
+	{
+		throw std::exception("Function \"int64_t GenerateIntermediate(std::vector<CodeItem> * intermediate_p, int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)\" says: Invalid parameter \"op\".");
+	}
+	if (CodeItem::c_none_ != dst_kind && CodeItem::c_register_ != dst_kind && CodeItem::c_variable_ != dst_kind)
+	{
+		throw std::exception("Function \"int64_t GenerateIntermediate(std::vector<CodeItem> * intermediate_p, int64_t op, int64_t dst_kind, int64_t dst, int64_t src_kind, int64_t src)\" says: Invalid parameter \"dst_kind\".");
+	}
+	// The code is only typed here, and its text is made in function "WriteIntermediateFile".
+	intermediate_p->push_back(CodeItem(op, dst_kind, dst, src_kind, src));
+	return 1;
+}
+
+int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)
+{
+	if (NULL == path || "" == path)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"path\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == function_table_p)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"function_table_p\".");
+	}
+	if (NULL == block_table)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"block_table\".");
+	}
+	if (NULL == symbol_table_p)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"symbol_table_p\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p, ThreadPool * thread_pool_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	const char * program = "PROGRAM START\n                    CALL main\nPROGRAM END\n\n\n";
+	int64_t function_number = function_table_p->size();
+	// text: the program, then each function head and each block in its own buffer (in order of output)
+	std::vector<std::vector<char> > text_table(1 + function_number + block_table->size());
+	text_table[0].assign(program, program + strlen(program));
+	thread_pool_p->ParallelFor(function_number + block_table->size(), [&](int64_t i)
+	{
+		if (i < function_number)
 		{
-		case '$':
-			if ('$' == word_p->content_[1])
-			{
-				// $$
-				return 1;
-			}
-			else
-			{
-				// $
-				return 0;
-			}
-		case '=':
-			if ('=' == word_p->content_[1])
-			{
-				// ==
-				return 12;
-			}
-			else
-			{
-				// =
-				return 2;
-			}
-		case '+':
-			return 3;
-			break;
-		case '-':
-			return 4;
-		case '*':
-			return 5;
-		case '/':
-			return 6;
-		case '%':
-			return 7;
-		case '(':
-			return 8;
-		case ')':
-			return 9;
-		case '>':
-			return 10;
-		case '<':
-			return 11;
-		case '!':
-			return 13;
-		case ';':
-			return 14;
-		case ',':
-			return 15;
-		case '{':
-			return 16;
-		case '}':
-			return 17;
-		default:
-			if (0 == strcmp(word_p->content_, "int"))
-			{
-				return 18;
-			}
-			else if (0 == strcmp(word_p->content_, "if"))
-			{
-				return 19;
-			}
-			else if (0 == strcmp(word_p->content_, "else"))
-			{
-				return 20;
-			}
-			else if (0 == strcmp(word_p->content_, "while"))
-			{
-				return 21;
-			}
-			else if (0 == strcmp(word_p->content_, "return"))
-			{
-				return 22;
-			}
-			else if (0 == strcmp(word_p->content_, "input"))
-			{
-				return 23;
-			}
-			else if (0 == strcmp(word_p->content_, "output"))
+			WriteIntermediateFile_Format(&(text_table[1 + i]), &((*function_table_p)[i]->intermediate), NULL, symbol_table_p);
+		}
+		else
+		{
+			WriteIntermediateFile_Format(&(text_table[1 + i]), &((*block_table)[i - function_number]->intermediate), (*block_table)[i - function_number], symbol_table_p);
+		}
+	});
+	// write in order
+	if (-1 == WriteIntermediateFile_Output(path, &text_table))
+	{
+		// error
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = 1;
+		return -1;
+	}
+	return 1;
+}
+
+void WriteIntermediateFile_Format(std::vector<char> * text_p, std::vector<CodeItem> * intermediate_p, Block * block_p, SymbolTable * symbol_table_p)
+{
+	// Format the codes of a function head or a block into one buffer, followed by two empty lines. "block_p" is the owner of the codes (NULL for a function head), where their words are.
+	const char * blank = "                    ";
+	std::vector<char> buffer(TokenStream::c_text_size_); // text of an operand (It grows for a long global name.)
+	CodeItem * code_item_p;
+	const char * text;
+	int64_t length;
+	text_p->clear();
+	text_p->reserve(intermediate_p->size() * 40 + 2);
+	for (int64_t i = 0; i < intermediate_p->size(); ++i)
+	{
+		code_item_p = &((*intermediate_p)[i]);
+		if (CodeItem::c_label_ == code_item_p->op_)
+		{
+			if (CodeItem::c_none_ == code_item_p->src_kind_)
 			{
-				return 24;
+				text_p->insert(text_p->end(), blank, blank + 20);
 			}
 			else
 			{
-				throw std::exception("Function \"int64_t ParseBlock_GetSymbol(Word * word_p)\" says: Invalid word. There is something wrong in function \"int64_t LexicalAnalyse(SourceFile * source_file_p, Error * error_p, std::vector<Block *> * block_pointer_table_p, bool is_block, void * pointer)\".");
+				text = WriteIntermediateFile_GetText(code_item_p, false, block_p, symbol_table_p, &buffer, &length);
+				text_p->insert(text_p->end(), text, text + length);
+				text_p->push_back(':');
 			}
+			text_p->push_back('\n');
+			continue;
+		}
+		text_p->insert(text_p->end(), blank, blank + 20);
+		text = CodeItem::s_op_name_table_[code_item_p->op_];
+		text_p->insert(text_p->end(), text, text + CodeItem::s_op_length_table_[code_item_p->op_]);
+		text_p->push_back(' ');
+		if (CodeItem::c_none_ != code_item_p->dst_kind_)
+		{
+			text = WriteIntermediateFile_GetText(code_item_p, true, block_p, symbol_table_p, &buffer, &length);
+			text_p->insert(text_p->end(), text, text + length);
+			text_p->push_back(' ');
+		}
+		if (CodeItem::c_none_ != code_item_p->src_kind_)
+		{
+			text = WriteIntermediateFile_GetText(code_item_p, false, block_p, symbol_table_p, &buffer, &length);
+			text_p->insert(text_p->end(), text, text + length);
 		}
+		text_p->push_back('\n');
 	}
-	word_p = word_p->next_;
+	text_p->push_back('\n');
+	text_p->push_back('\n');
 }
 
-int64_t GenerateIntermediate(std::vector<CodeItem *> * intermediate_p, char * label, char * op, char * dst, char * src)
+const char * WriteIntermediateFile_GetText(CodeItem * code_item_p, bool is_dst, Block * block_p, SymbolTable * symbol_table_p, std::vector<char> * buffer_p, int64_t * length_p)
 {
-	if (NULL == intermediate_p)
+	// Return the text of an operand (in "buffer_p" if it has to be made, which has at least "TokenStream::c_text_size_" chars), and its length in "length_p".
+	int64_t kind = is_dst ? code_item_p->dst_kind_ : code_item_p->src_kind_;
+	int64_t value = is_dst ? code_item_p->dst_ : code_item_p->src_;
+	char * buffer = &((*buffer_p)[0]);
+	switch (kind)
 	{
-		throw std::exception("Function \"int64_t GenerateIntermediate(std::vector<CodeItem *> * intermediate_p, char * label, char * op, char * dst, char * src)\" says: Invalid parameter \"intermediate_p\".");
+	case CodeItem::c_register_:
+		*length_p = CodeItem::s_register_length_table_[value];
+		return CodeItem::s_register_name_table_[value];
+	case CodeItem::c_variable_:
+		return symbol_table_p->GetVariable(value)->GetGlobalName(buffer_p, length_p);
+	case CodeItem::c_immediate_:
+		*length_p = CodeItem::s_FormatInteger(value, buffer);
+		return buffer;
+	case CodeItem::c_label_id_:
+		Block::s_GetLabelName(value, buffer);
+		*length_p = strlen(buffer);
+		return buffer;
+	case CodeItem::c_function_:
+		*length_p = Interner::s_interner_.GetLength(value);
+		return Interner::s_interner_.GetText(value);
+	case CodeItem::c_word_:
+		if (NULL == block_p)
+		{
+			break;
+		}
+		block_p->token_stream.CopyText(value, buffer);
+		*length_p = strlen(buffer);
+		return buffer;
+	default:
+		break;
 	}
-	intermediate_p->push_back(NULL);
-	(*intermediate_p)[intermediate_p->size() - 1] = CodeItem::s_Malloc();
-	if (NULL == (*intermediate_p)[intermediate_p->size() - 1])
+	throw std::exception("Function \"const char * WriteIntermediateFile_GetText(CodeItem * code_item_p, bool is_dst, Block * block_p, SymbolTable * symbol_table_p, std::vector<char> * buffer_p, int64_t * length_p)\" says: Invalid operand.");
+}
+
+int64_t WriteIntermediateFile_Output(char * path, std::vector<std::vector<char> > * text_table_p)
+{
+	// Write the buffers in order with as few calls as possible. Return -1 if the file can not be opened or written.
+#ifdef _WIN32
+	// The file is opened in text mode, so line feeds are written as they were by "fwrite".
+	FILE * fp = fopen(path, "w");
+	if (NULL == fp)
 	{
 		return -1;
 	}
-	if (label)
+	for (int64_t i = 0; i < text_table_p->size(); ++i)
 	{
-		if (-1 == (*intermediate_p)[intermediate_p->size() - 1]->SetLabel(label))
+		if ((*text_table_p)[i].size() > 0 && 1 != fwrite(&((*text_table_p)[i][0]), (*text_table_p)[i].size(), 1, fp))
 		{
+			fclose(fp);
 			return -1;
 		}
 	}
-	if (op)
+	fclose(fp);
+	return 1;
+#else
+	int file_descriptor = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (-1 == file_descriptor)
 	{
-		if (-1 == (*intermediate_p)[intermediate_p->size() - 1]->SetOp(op))
-		{
-			return -1;
-		}
+		return -1;
 	}
-	if (dst)
+	// "writev" takes at most "IOV_MAX" buffers, and it may write only a part of them.
+	std::vector<struct iovec> vector_table;
+	for (int64_t i = 0; i < text_table_p->size(); ++i)
 	{
-		if (-1 == (*intermediate_p)[intermediate_p->size() - 1]->SetDst(dst))
+		if ((*text_table_p)[i].size() > 0)
 		{
-			return -1;
+			struct iovec vector;
+			vector.iov_base = &((*text_table_p)[i][0]);
+			vector.iov_len = (*text_table_p)[i].size();
+			vector_table.push_back(vector);
 		}
 	}
-	if (src)
+	int64_t index = 0;
+	int64_t number;
+	ssize_t written;
+	while (index < vector_table.size())
 	{
-		if (-1 == (*intermediate_p)[intermediate_p->size() - 1]->SetSrc(src))
+		number = vector_table.size() - index < IOV_MAX ? vector_table.size() - index : IOV_MAX;
+		written = writev(file_descriptor, &(vector_table[index]), number);
+		if (written < 0)
 		{
+			close(file_descriptor);
 			return -1;
 		}
+		while (index < vector_table.size() && written >= (ssize_t)vector_table[index].iov_len)
+		{
+			written -= vector_table[index].iov_len;
+			index += 1;
+		}
+		if (written > 0)
+		{
+			vector_table[index].iov_base = (char *)vector_table[index].iov_base + written;
+			vector_table[index].iov_len -= written;
+		}
 	}
+	close(file_descriptor);
 	return 1;
+#endif
 }
 
-int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)
+int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)
 {
-	if (NULL == path || "" == path)
+	// the same codes as the intermediate file, in the binary container of "ir_file.h"
+	if (NULL == path)
 	{
-		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"path\".");
+		throw std::exception("Function \"int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)\" says: Invalid parameter \"path\".");
 	}
 	if (NULL == error_p)
 	{
-		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"error_p\".");
+		throw std::exception("Function \"int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)\" says: Invalid parameter \"error_p\".");
 	}
 	if (NULL == function_table_p)
 	{
-		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"function_table_p\".");
+		throw std::exception("Function \"int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)\" says: Invalid parameter \"function_table_p\".");
 	}
 	if (NULL == block_table)
 	{
-		throw std::exception("Function \"int64_t WriteIntermediateFile(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table)\" says: Invalid parameter \"block_table\".");
+		throw std::exception("Function \"int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)\" says: Invalid parameter \"block_table\".");
 	}
-	char * path_out = path;
-	FILE * fp = NULL;
-	FunctionItem * function_item_p;
+	if (NULL == symbol_table_p)
+	{
+		throw std::exception("Function \"int64_t WriteIntermediateImage(char * path, Error * error_p, std::vector<FunctionItem *> * function_table_p, std::vector<Block *> * block_table, SymbolTable * symbol_table_p)\" says: Invalid parameter \"symbol_table_p\".");
+	}
+	IrFile ir_file;
+	std::vector<char> dst_buffer(TokenStream::c_text_size_);
+	std::vector<char> src_buffer(TokenStream::c_text_size_);
+	const char * dst_text;
+	const char * src_text;
+	int64_t length;
+	std::vector<CodeItem> * intermediate_p;
 	Block * block_p;
-	CodeItem * codeitem_p;
-	// open file
-	fp = fopen(path_out, "w");
-	if (NULL == fp)
+	for (int64_t i = 0; i < function_table_p->size() + block_table->size(); ++i)
+	{
+		// function heads, then blocks (the owners of words)
+		intermediate_p = i < function_table_p->size() ? &((*function_table_p)[i]->intermediate) : &((*block_table)[i - function_table_p->size()]->intermediate);
+		block_p = i < function_table_p->size() ? NULL : (*block_table)[i - function_table_p->size()];
+		ir_file.AppendListing();
+		for (int64_t j = 0; j < intermediate_p->size(); ++j)
+		{
+			CodeItem * code_item_p = &((*intermediate_p)[j]);
+			dst_text = CodeItem::c_none_ == code_item_p->dst_kind_ ? NULL : WriteIntermediateFile_GetText(code_item_p, true, block_p, symbol_table_p, &dst_buffer, &length);
+			src_text = CodeItem::c_none_ == code_item_p->src_kind_ ? NULL : WriteIntermediateFile_GetText(code_item_p, false, block_p, symbol_table_p, &src_buffer, &length);
+			ir_file.AppendCode(code_item_p->op_, code_item_p->dst_kind_, code_item_p->dst_, dst_text, code_item_p->src_kind_, code_item_p->src_, src_text);
+		}
+	}
+	ir_file.Build();
+	if (-1 == ir_file.Save(path))
 	{
 		// error
 		error_p->major_no_ = 5;
-		error_p->minor_no_ = 1;
+		error_p->minor_no_ = 2;
 		return -1;
 	}
-	// program
-	fwrite("PROGRAM START\n", strlen("PROGRAM START\n"), 1, fp);
-	fwrite("                    CALL main\n", strlen("                    CALL main\n"), 1, fp);
-	fwrite("PROGRAM END\n", strlen("PROGRAM END\n"), 1, fp);
-	fwrite("\n\n", strlen("\n\n"), 1, fp);
-	// function
-	for (int64_t i = 0; i < function_table_p->size(); ++i)
+	return 1;
+}
+
+int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p)
+{
+	// binary to text, or text to binary (by the magic at the beginning of the input). "line_p" is the invalid line of a text file (0 for an unexpected ending, -1 if none).
+	if (NULL == input_path)
 	{
-		function_item_p = (*function_table_p)[i];
-		for (int64_t j = 0; j < function_item_p->intermediate.size(); ++j)
-		{
-			codeitem_p = (function_item_p->intermediate)[j];
-			if (codeitem_p->label_)
-			{
-				fwrite(codeitem_p->label_, strlen(codeitem_p->label_), 1, fp);
-				fwrite(":", 1, 1, fp);
-			}
-			else
-			{
-				fwrite("                    ", 20, 1, fp);
-			}
-			if (codeitem_p->op_)
-			{
-				fwrite(codeitem_p->op_, strlen(codeitem_p->op_), 1, fp);
-				fwrite(" ", 1, 1, fp);
-			}
-			if (codeitem_p->dst_)
-			{
-				fwrite(codeitem_p->dst_, strlen(codeitem_p->dst_), 1, fp);
-				fwrite(" ", 1, 1, fp);
-			}
-			if (codeitem_p->src_)
-			{
-				fwrite(codeitem_p->src_, strlen(codeitem_p->src_), 1, fp);
-			}
-			fwrite("\n", 1, 1, fp);
-		}
-		fwrite("\n\n", strlen("\n\n"), 1, fp);
+		throw std::exception("Function \"int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"input_path\".");
+	}
+	if (NULL == output_path)
+	{
+		throw std::exception("Function \"int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"output_path\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == line_p)
+	{
+		throw std::exception("Function \"int64_t ConvertIntermediateFile(char * input_path, char * output_path, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"line_p\".");
 	}
-	// block
-	for (int64_t i = 0; i < block_table->size(); ++i)
+	IrFile ir_file;
+	int64_t is_image = IrFile::s_IsImage(input_path);
+	*line_p = -1;
+	if (-1 == is_image)
 	{
-		block_p = (*block_table)[i];
-		for (int64_t j = 0; j < block_p->intermediate.size(); ++j)
+		// error
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = 3;
+		return -1;
+	}
+	if (1 == is_image)
+	{
+		if (-1 == ir_file.Load(input_path))
 		{
-			codeitem_p = (block_p->intermediate)[j];
-			if (codeitem_p->label_)
-			{
-				fwrite(codeitem_p->label_, strlen(codeitem_p->label_), 1, fp);
-				fwrite(":", 1, 1, fp);
-			}
-			else
-			{
-				fwrite("                    ", 20, 1, fp);
-			}
-			if (codeitem_p->op_)
-			{
-				fwrite(codeitem_p->op_, strlen(codeitem_p->op_), 1, fp);
-				fwrite(" ", 1, 1, fp);
-			}
-			if (codeitem_p->dst_)
-			{
-				fwrite(codeitem_p->dst_, strlen(codeitem_p->dst_), 1, fp);
-				fwrite(" ", 1, 1, fp);
-			}
-			if (codeitem_p->src_)
-			{
-				fwrite(codeitem_p->src_, strlen(codeitem_p->src_), 1, fp);
-			}
-			fwrite("\n", 1, 1, fp);
+			// error
+			error_p->major_no_ = 5;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		if (-1 == ir_file.WriteText(output_path))
+		{
+			// error
+			error_p->major_no_ = 5;
+			error_p->minor_no_ = 1;
+			return -1;
 		}
-		fwrite("\n\n", strlen("\n\n"), 1, fp);
+		return 1;
+	}
+	if (-1 == ir_file.ReadText(input_path))
+	{
+		// error
+		*line_p = ir_file.error_line_;
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = -1 == ir_file.error_line_ ? 3 : 4;
+		return -1;
+	}
+	if (-1 == ir_file.Save(output_path))
+	{
+		// error
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = 2;
+		return -1;
 	}
-	// close file
-	fclose(fp);
-	fp = NULL;
 	return 1;
 }
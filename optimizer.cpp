@@ -0,0 +1,349 @@
+#pragma warning(disable:4244)
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <vector>
+#include <chrono>
+#include <exception>
+#include "source_file.h"
+#include "error.h"
+#include "code_item.h"
+#include "ir_file.h"
+
+// limit of jumps followed from one jump (to stop at a loop of jumps)
+const int64_t c_max_thread_ = 16;
+
+int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p);
+int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p);
+int64_t OptimizeIntermediate_Thread(IrFile * ir_file_p, std::vector<int64_t> * label_code_table_p, std::vector<int64_t> * listing_end_table_p, int64_t label);
+bool OptimizeIntermediate_IsJump(const CodeItem * code_item_p);
+int64_t SaveIntermediateFile(char * path, IrFile * ir_file_p, bool is_image, Error * error_p);
+
+int main(int argc, char ** argv)
+{
+	// The optimizer loads an intermediate file (text or binary), optimizes the codes and writes them again without the front end.
+	char input_path[1024];
+	char output_path[1024];
+	// option: "-b" writes the binary intermediate file instead of the text (see "ir_file.h").
+	bool is_image = false;
+	int64_t line;
+	int64_t threaded;
+	int64_t removed;
+	double second;
+	char * path_table[2];
+	int64_t path_number = 0;
+	SourceFile source_file;
+	Error error;
+	IrFile input;
+	IrFile output;
+	std::chrono::steady_clock::time_point beginning;
+	printf("\n");
+	for (int64_t i = 1; i < argc; ++i)
+	{
+		if (0 == strcmp(argv[i], "-b"))
+		{
+			is_image = true;
+		}
+		else if (path_number < 2)
+		{
+			path_table[path_number] = argv[i];
+			path_number += 1;
+		}
+	}
+	if (path_number == 2)
+	{
+		strcpy(input_path, path_table[0]);
+		strcpy(output_path, path_table[1]);
+	}
+	else if (path_number == 1)
+	{
+		strcpy(input_path, path_table[0]);
+		printf("Input optimized intermediate file path:\n");
+		scanf("%s", output_path);
+		printf("\n");
+	}
+	else
+	{
+		printf("Input intermediate file path:\n");
+		scanf("%s", input_path);
+		printf("\n");
+		printf("Input optimized intermediate file path:\n");
+		scanf("%s", output_path);
+		printf("\n");
+	}
+	printf("Loading intermediate file ...\n");
+	printf("\n");
+	beginning = std::chrono::steady_clock::now();
+	if (-1 == LoadIntermediateFile(input_path, &input, &error, &line))
+	{
+		printf("%s\n", error.GetErrorString(&source_file));
+		if (line > 0)
+		{
+			printf("Line: %I64d\n", line);
+		}
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
+	}
+	second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+	printf("Load: %I64d bytes, %I64d codes in %.3f s (%.1f MB/s).\n", input.file_size_, input.header_->code_number_, second, second > 0 ? input.file_size_ / second / 1000000 : 0.0);
+	printf("\n");
+	printf("Optimizing ...\n");
+	printf("\n");
+	OptimizeIntermediate(&input, &output, &threaded, &removed);
+	printf("Jumps threaded: %I64d, codes removed: %I64d (%I64d codes left).\n", threaded, removed, output.header_->code_number_);
+	printf("\n");
+	printf("Writing intermediate file ...\n");
+	printf("\n");
+	if (-1 == SaveIntermediateFile(output_path, &output, is_image, &error))
+	{
+		printf("%s\n", error.GetErrorString(&source_file));
+		printf("\n");
+		printf("Fail.\n");
+		printf("\n");
+		system("PAUSE");
+		return 0;
+	}
+	printf("Complete.\n");
+	printf("\n");
+	system("PAUSE");
+	return 0;
+}
+
+int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p)
+{
+	// a binary file (by the magic at the beginning), or a text file. "line_p" is the invalid line of a text file (0 for an unexpected ending, -1 if none).
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"path\".");
+	}
+	if (NULL == ir_file_p)
+	{
+		throw std::exception("Function \"int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"ir_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (NULL == line_p)
+	{
+		throw std::exception("Function \"int64_t LoadIntermediateFile(char * path, IrFile * ir_file_p, Error * error_p, int64_t * line_p)\" says: Invalid parameter \"line_p\".");
+	}
+	int64_t is_image = IrFile::s_IsImage(path);
+	*line_p = -1;
+	if (-1 == is_image)
+	{
+		// error
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = 3;
+		return -1;
+	}
+	if (1 == is_image)
+	{
+		if (-1 == ir_file_p->Load(path))
+		{
+			// error
+			error_p->major_no_ = 5;
+			error_p->minor_no_ = 4;
+			return -1;
+		}
+		return 1;
+	}
+	if (-1 == ir_file_p->ReadText(path))
+	{
+		// error
+		*line_p = ir_file_p->error_line_;
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = -1 == ir_file_p->error_line_ ? 3 : 4;
+		return -1;
+	}
+	return 1;
+}
+
+int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p)
+{
+	// Peephole optimization on the codes of each listing (labels are global, so a jump may go to another listing):
+	// 1. A jump to a label followed by "JMP [label]" goes to the last label directly.
+	// 2. Codes after "JMP" or "RET" are removed until the next label.
+	// 3. A jump to a label defined right after it (with only labels and removed codes between) is removed.
+	// 4. Labels of no block (lines of 20 blanks) are removed.
+	if (NULL == input_p || NULL == input_p->header_)
+	{
+		throw std::exception("Function \"int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p)\" says: Invalid parameter \"input_p\".");
+	}
+	if (NULL == output_p)
+	{
+		throw std::exception("Function \"int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p)\" says: Invalid parameter \"output_p\".");
+	}
+	if (NULL == threaded_p)
+	{
+		throw std::exception("Function \"int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p)\" says: Invalid parameter \"threaded_p\".");
+	}
+	if (NULL == removed_p)
+	{
+		throw std::exception("Function \"int64_t OptimizeIntermediate(IrFile * input_p, IrFile * output_p, int64_t * threaded_p, int64_t * removed_p)\" says: Invalid parameter \"removed_p\".");
+	}
+	const IrFile::Header * header_p = input_p->header_;
+	const CodeItem * code_table = input_p->code_table_;
+	// string id of a label -> the code which defines it (-1 if none)
+	std::vector<int64_t> label_code_table(header_p->string_number_, -1);
+	// code -> the end of its listing
+	std::vector<int64_t> listing_end_table(header_p->code_number_);
+	std::vector<int64_t> target_table(header_p->code_number_);
+	std::vector<bool> keep_table(header_p->code_number_, true);
+	int64_t beginning;
+	int64_t end;
+	int64_t k;
+	bool is_reachable;
+	*threaded_p = 0;
+	*removed_p = 0;
+	for (int64_t i = 0; i < header_p->label_number_; ++i)
+	{
+		label_code_table[input_p->label_table_[i].string_] = input_p->label_table_[i].code_;
+	}
+	for (int64_t i = 0; i < header_p->listing_number_; ++i)
+	{
+		beginning = input_p->listing_table_[i].code_beginning_;
+		end = beginning + input_p->listing_table_[i].code_number_;
+		for (int64_t j = beginning; j < end; ++j)
+		{
+			listing_end_table[j] = end;
+		}
+	}
+	// 1, 2 and 4
+	for (int64_t i = 0; i < header_p->listing_number_; ++i)
+	{
+		beginning = input_p->listing_table_[i].code_beginning_;
+		end = beginning + input_p->listing_table_[i].code_number_;
+		is_reachable = true;
+		for (int64_t j = beginning; j < end; ++j)
+		{
+			target_table[j] = code_table[j].src_;
+			if (CodeItem::c_label_ == code_table[j].op_)
+			{
+				if (CodeItem::c_none_ == code_table[j].src_kind_)
+				{
+					keep_table[j] = false;
+				}
+				else
+				{
+					is_reachable = true;
+				}
+				continue;
+			}
+			if (false == is_reachable)
+			{
+				keep_table[j] = false;
+				continue;
+			}
+			if (OptimizeIntermediate_IsJump(&(code_table[j])))
+			{
+				target_table[j] = OptimizeIntermediate_Thread(input_p, &label_code_table, &listing_end_table, code_table[j].src_);
+				if (target_table[j] != code_table[j].src_)
+				{
+					*threaded_p += 1;
+				}
+			}
+			if (CodeItem::c_jmp_ == code_table[j].op_ || CodeItem::c_ret_ == code_table[j].op_)
+			{
+				is_reachable = false;
+			}
+		}
+	}
+	// 3 (backward, so a jump before a removed one is checked after it)
+	for (int64_t i = header_p->code_number_ - 1; i >= 0; --i)
+	{
+		if (false == keep_table[i] || false == OptimizeIntermediate_IsJump(&(code_table[i])))
+		{
+			continue;
+		}
+		for (k = i + 1; k < listing_end_table[i] && (false == keep_table[k] || CodeItem::c_label_ == code_table[k].op_); ++k)
+		{
+			if (keep_table[k] && CodeItem::c_label_id_ == code_table[k].src_kind_ && code_table[k].src_ == target_table[i])
+			{
+				keep_table[i] = false;
+				break;
+			}
+		}
+	}
+	// output
+	const char * dst_text;
+	const char * src_text;
+	for (int64_t i = 0; i < header_p->listing_number_; ++i)
+	{
+		output_p->AppendListing();
+		beginning = input_p->listing_table_[i].code_beginning_;
+		end = beginning + input_p->listing_table_[i].code_number_;
+		for (int64_t j = beginning; j < end; ++j)
+		{
+			if (false == keep_table[j])
+			{
+				*removed_p += 1;
+				continue;
+			}
+			dst_text = CodeItem::c_variable_ == code_table[j].dst_kind_ ? input_p->GetString(code_table[j].dst_) : NULL;
+			src_text = CodeItem::c_variable_ == code_table[j].src_kind_ || CodeItem::c_label_id_ == code_table[j].src_kind_ || CodeItem::c_function_ == code_table[j].src_kind_ ? input_p->GetString(target_table[j]) : NULL;
+			output_p->AppendCode(code_table[j].op_, code_table[j].dst_kind_, code_table[j].dst_, dst_text, code_table[j].src_kind_, target_table[j], src_text);
+		}
+	}
+	output_p->Build();
+	return 1;
+}
+
+int64_t OptimizeIntermediate_Thread(IrFile * ir_file_p, std::vector<int64_t> * label_code_table_p, std::vector<int64_t> * listing_end_table_p, int64_t label)
+{
+	// Return the label where a jump to "label" finally goes.
+	const CodeItem * code_table = ir_file_p->code_table_;
+	int64_t code;
+	for (int64_t i = 0; i < c_max_thread_; ++i)
+	{
+		code = (*label_code_table_p)[label];
+		if (-1 == code)
+		{
+			break;
+		}
+		// the first instruction after the label (in the same listing)
+		int64_t end = (*listing_end_table_p)[code];
+		for (code += 1; code < end && CodeItem::c_label_ == code_table[code].op_; ++code)
+		{
+		}
+		if (code == end || CodeItem::c_jmp_ != code_table[code].op_ || CodeItem::c_label_id_ != code_table[code].src_kind_ || label == code_table[code].src_)
+		{
+			break;
+		}
+		label = code_table[code].src_;
+	}
+	return label;
+}
+
+bool OptimizeIntermediate_IsJump(const CodeItem * code_item_p)
+{
+	// "JMP", "JE", "JG" or "JL" to a label
+	return (CodeItem::c_jmp_ == code_item_p->op_ || CodeItem::c_je_ == code_item_p->op_ || CodeItem::c_jg_ == code_item_p->op_ || CodeItem::c_jl_ == code_item_p->op_) && CodeItem::c_label_id_ == code_item_p->src_kind_;
+}
+
+int64_t SaveIntermediateFile(char * path, IrFile * ir_file_p, bool is_image, Error * error_p)
+{
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t SaveIntermediateFile(char * path, IrFile * ir_file_p, bool is_image, Error * error_p)\" says: Invalid parameter \"path\".");
+	}
+	if (NULL == ir_file_p)
+	{
+		throw std::exception("Function \"int64_t SaveIntermediateFile(char * path, IrFile * ir_file_p, bool is_image, Error * error_p)\" says: Invalid parameter \"ir_file_p\".");
+	}
+	if (NULL == error_p)
+	{
+		throw std::exception("Function \"int64_t SaveIntermediateFile(char * path, IrFile * ir_file_p, bool is_image, Error * error_p)\" says: Invalid parameter \"error_p\".");
+	}
+	if (-1 == (is_image ? ir_file_p->Save(path) : ir_file_p->WriteText(path)))
+	{
+		// error
+		error_p->major_no_ = 5;
+		error_p->minor_no_ = is_image ? 2 : 1;
+		return -1;
+	}
+	return 1;
+}
@@ -0,0 +1,93 @@
+#ifndef PARSER_STATE_H_
+#define PARSER_STATE_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include "source_file.h"
+#include "error.h"
+#include "block.h"
+#include "block_tree.h"
+#include "function_item.h"
+#include "symbol_table.h"
+#include "grammar_table.h"
+
+class PrattFrame
+{
+public:
+	// rule of the Pratt engine: The rules call each other by pushing frames on "ParserState::frame_stack_" instead of recursion, so expressions may be nested without limit.
+	static const int64_t c_expression_ = 0;
+	static const int64_t c_factor_ = 1;
+	static const int64_t c_parenthesis_ = 2;
+	static const int64_t c_operand_ = 3;
+	static const int64_t c_call_ = 4;
+	PrattFrame();
+	int64_t rule_;
+	int64_t step_; // where the rule goes on when the rule it calls returns (0 at the beginning)
+	int64_t power_; // binding power of the operator before an expression
+	int64_t symbol_; // operator of the phrase to reduce
+	int64_t production_;
+	// "!" before the content of "( )": They are words from "first_not_" on.
+	int64_t first_not_;
+	int64_t not_number_;
+	int64_t phrase_word_[GrammarTable::c_max_right_length_];
+};
+
+PrattFrame::PrattFrame()
+{
+	rule_ = c_expression_;
+	step_ = 0;
+	power_ = 0;
+	symbol_ = -1;
+	production_ = -1;
+	first_not_ = -1;
+	not_number_ = 0;
+}
+
+class ParserState
+{
+public:
+	// engine: the driver of "ParseBlock" (Both of them call the same semantic action of each production.)
+	static const int64_t c_precedence_engine_ = 0;
+	static const int64_t c_pratt_engine_ = 1;
+	ParserState();
+	// environment
+	SourceFile * source_file_;
+	Error * error_;
+	Block * block_;
+	std::vector<FunctionItem *> * function_table_;
+	BlockTree * block_tree_;
+	SymbolTable * symbol_table_;
+	// register: It is locked while holding a value.
+	bool rc1_lock_;
+	bool rc2_lock_;
+	bool rc3_lock_;
+	// labels of the last blocks of "if" and "while" (They are kept if the block is not found, and -1 means none.)
+	int64_t label_block_1_in_;
+	int64_t label_block_1_out_;
+	int64_t label_block_2_in_;
+	int64_t label_block_2_out_;
+	// frames of the rules running (only in the Pratt engine)
+	std::vector<PrattFrame> frame_stack_;
+};
+
+ParserState::ParserState()
+{
+	source_file_ = NULL;
+	error_ = NULL;
+	block_ = NULL;
+	function_table_ = NULL;
+	block_tree_ = NULL;
+	symbol_table_ = NULL;
+	rc1_lock_ = false;
+	rc2_lock_ = false;
+	rc3_lock_ = false;
+	label_block_1_in_ = -1;
+	label_block_1_out_ = -1;
+	label_block_2_in_ = -1;
+	label_block_2_out_ = -1;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef PREPROCESS_SLICE_H_
+#define PREPROCESS_SLICE_H_
+
+#include <stdint.h>
+#include <vector>
+
+// What a slice of the structural characters gives in function "Preprocess" in parallel. Everything is local to the slice: locations are in the source file, but depths are relative to the beginning of the slice, and blocks and annotations are numbered from 0 in the slice.
+// A prefix pass over the slices gives their depths at the beginning and their offsets, then each slice is copied into its place.
+class PreprocessSlice
+{
+public:
+	// tag: the last annotation tag of the slice
+	static const int64_t c_tag_none_ = 0;
+	static const int64_t c_tag_beginning_ = 1; // "/" "*"
+	static const int64_t c_tag_end_ = 2; // "*" "/"
+	PreprocessSlice();
+	// range in the table of structural characters
+	int64_t beginning_;
+	int64_t end_;
+	int64_t last_tag_;
+	// Braces in an annotation are ignored, so it must be known before the slice is traversed.
+	bool annotation_;
+	// line: beginnings of lines
+	std::vector<int64_t> line_table_;
+	// annotation: beginning and end of each annotation beginning in the slice (end: -1 if it does not end in the slice)
+	std::vector<int64_t> annotation_beginning_table_;
+	std::vector<int64_t> annotation_end_table_;
+	// the last end before the first beginning: It is the end of the last annotation of the slices before. (-1 if none)
+	int64_t outer_annotation_end_;
+	// depth of annotation tags: at the end, and the lowest one
+	int64_t annotation_depth_;
+	int64_t annotation_minimum_;
+	// block: beginning, end (-1 if it does not end in the slice) and parent (in the slice, or "BlockTree::c_none_" if it is out of the slice) of each block beginning in the slice
+	std::vector<int64_t> block_beginning_table_;
+	std::vector<int64_t> block_end_table_;
+	std::vector<int64_t> block_parent_table_;
+	// blocks whose parent is out of the slice: the block, and the depth before its "{"
+	std::vector<int64_t> outer_block_table_;
+	std::vector<int64_t> outer_block_depth_table_;
+	// filled in by the prefix pass: parent and root of them
+	std::vector<int64_t> outer_parent_table_;
+	std::vector<int64_t> outer_root_table_;
+	// "}" in order: the block (in the slice, or "BlockTree::c_none_" if it is out of the slice)
+	std::vector<int64_t> close_table_;
+	// "}" of blocks out of the slice: location, and the depth after it
+	std::vector<int64_t> outer_close_location_table_;
+	std::vector<int64_t> outer_close_depth_table_;
+	// filled in by the prefix pass: the block of them
+	std::vector<int64_t> outer_close_block_table_;
+	// "}" down to the lowest depth so far, where a function may come to an end: index in "close_table_", location and the depth after it
+	std::vector<int64_t> bottom_close_table_;
+	std::vector<int64_t> bottom_close_location_table_;
+	std::vector<int64_t> bottom_close_depth_table_;
+	// blocks still open at the end of the slice, from the outermost one
+	std::vector<int64_t> open_table_;
+	// depth of braces: at the end, and the lowest one
+	int64_t brace_depth_;
+	int64_t brace_minimum_;
+	// filled in by the prefix pass: depths at the beginning, and offsets in the tables of the source file and the block tree
+	int64_t annotation_depth_beginning_;
+	int64_t brace_depth_beginning_;
+	int64_t line_offset_;
+	int64_t annotation_offset_;
+	int64_t block_offset_;
+	int64_t close_offset_;
+	// false if out of memory
+	bool succeeded_;
+};
+
+PreprocessSlice::PreprocessSlice()
+{
+	beginning_ = 0;
+	end_ = 0;
+	last_tag_ = c_tag_none_;
+	annotation_ = false;
+	outer_annotation_end_ = -1;
+	annotation_depth_ = 0;
+	annotation_minimum_ = 0;
+	brace_depth_ = 0;
+	brace_minimum_ = 0;
+	annotation_depth_beginning_ = 0;
+	brace_depth_beginning_ = 0;
+	line_offset_ = 0;
+	annotation_offset_ = 0;
+	block_offset_ = 0;
+	close_offset_ = 0;
+	succeeded_ = true;
+}
+
+#endif
@@ -0,0 +1,430 @@
+#ifndef SCANNER_H_
+#define SCANNER_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <exception>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCANNER_SSE2_
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#define SCANNER_AVX2_
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include <vector>
+#include "thread_pool.h"
+
+class Scanner
+{
+public:
+	static const int64_t c_chunk_size_ = 1 << 20;
+	// SIMD used in searching: the best one built by default (option "-s" of the program, to compare them)
+	static const int64_t c_simd_scalar_ = 0;
+	static const int64_t c_simd_sse2_ = 1;
+	static const int64_t c_simd_avx2_ = 2;
+	static int64_t s_simd_;
+	// run: a sequence of characters of the same kind
+	static const int64_t c_run_blank_ = 0; // space, \t, \r, \n
+	static const int64_t c_run_digit_ = 1; // 0 - 9
+	static const int64_t c_run_identifier_ = 2; // A - Z, a - z, 0 - 9, _
+	static int64_t s_GetBestSimd();
+	static bool s_IsStructure(char ch);
+	static int64_t s_SearchStructure(const char * content, int64_t index, int64_t size);
+	static void s_SearchStructureParallel(const char * content, int64_t size, ThreadPool * thread_pool_p, std::vector<int64_t> * structure_table_p);
+	static bool s_IsRun(char ch, int64_t run);
+	static int64_t s_SearchRunEnd(const char * content, int64_t index, int64_t size, int64_t run);
+private:
+#ifdef SCANNER_SSE2_
+	static __m128i s_MatchRun(__m128i block, int64_t run);
+#endif
+#ifdef SCANNER_AVX2_
+	static __m256i s_MatchRun(__m256i block, int64_t run);
+#endif
+	static int64_t s_FirstBit(uint32_t mask);
+	static bool s_IsPair(const char * content, int64_t index, int64_t size);
+	static int64_t s_SearchStructureChunk(const char * content, int64_t index, int64_t end, int64_t size, const std::vector<int64_t> * join_table_p, int64_t * join_index_p, std::vector<int64_t> * structure_table_p);
+};
+
+int64_t Scanner::s_simd_ = Scanner::s_GetBestSimd();
+
+int64_t Scanner::s_GetBestSimd()
+{
+#if defined(SCANNER_AVX2_)
+	return c_simd_avx2_;
+#elif defined(SCANNER_SSE2_)
+	return c_simd_sse2_;
+#else
+	return c_simd_scalar_;
+#endif
+}
+
+bool Scanner::s_IsStructure(char ch)
+{
+	// structural characters of function "Preprocess": line feed, annotation tag and brace
+	switch (ch)
+	{
+	case '\r':
+	case '\n':
+	case '/':
+	case '*':
+	case '{':
+	case '}':
+		return true;
+	default:
+		return false;
+	}
+}
+
+int64_t Scanner::s_SearchStructure(const char * content, int64_t index, int64_t size)
+{
+	// Return the location of the first structural character in [index, size), or "size" if there is none.
+	if (NULL == content)
+	{
+		throw std::exception("Function \"int64_t Scanner::s_SearchStructure(const char * content, int64_t index, int64_t size)\" says: Invalid parameter \"content\".");
+	}
+#ifdef SCANNER_AVX2_
+	// 32 characters per step
+	const __m256i cr_32 = _mm256_set1_epi8('\r');
+	const __m256i lf_32 = _mm256_set1_epi8('\n');
+	const __m256i slash_32 = _mm256_set1_epi8('/');
+	const __m256i star_32 = _mm256_set1_epi8('*');
+	const __m256i left_brace_32 = _mm256_set1_epi8('{');
+	const __m256i right_brace_32 = _mm256_set1_epi8('}');
+	__m256i block_32;
+	__m256i match_32;
+	uint32_t mask_32;
+	for (; c_simd_avx2_ == s_simd_ && index + 32 <= size; index += 32)
+	{
+		block_32 = _mm256_loadu_si256((const __m256i *)(content + index));
+		match_32 = _mm256_or_si256(_mm256_cmpeq_epi8(block_32, cr_32), _mm256_cmpeq_epi8(block_32, lf_32));
+		match_32 = _mm256_or_si256(match_32, _mm256_cmpeq_epi8(block_32, slash_32));
+		match_32 = _mm256_or_si256(match_32, _mm256_cmpeq_epi8(block_32, star_32));
+		match_32 = _mm256_or_si256(match_32, _mm256_cmpeq_epi8(block_32, left_brace_32));
+		match_32 = _mm256_or_si256(match_32, _mm256_cmpeq_epi8(block_32, right_brace_32));
+		mask_32 = (uint32_t)_mm256_movemask_epi8(match_32);
+		if (0 != mask_32)
+		{
+			return index + s_FirstBit(mask_32);
+		}
+	}
+#endif
+#ifdef SCANNER_SSE2_
+	// 16 characters per step
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i lf = _mm_set1_epi8('\n');
+	const __m128i slash = _mm_set1_epi8('/');
+	const __m128i star = _mm_set1_epi8('*');
+	const __m128i left_brace = _mm_set1_epi8('{');
+	const __m128i right_brace = _mm_set1_epi8('}');
+	__m128i block;
+	__m128i match;
+	uint32_t mask;
+	for (; s_simd_ >= c_simd_sse2_ && index + 16 <= size; index += 16)
+	{
+		block = _mm_loadu_si128((const __m128i *)(content + index));
+		match = _mm_or_si128(_mm_cmpeq_epi8(block, cr), _mm_cmpeq_epi8(block, lf));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, slash));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, star));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, left_brace));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, right_brace));
+		mask = (uint32_t)_mm_movemask_epi8(match);
+		if (0 != mask)
+		{
+			return index + s_FirstBit(mask);
+		}
+	}
+#endif
+	// the remaining part (or all, without SIMD)
+	for (; index < size; ++index)
+	{
+		if (s_IsStructure(content[index]))
+		{
+			return index;
+		}
+	}
+	return size;
+}
+
+void Scanner::s_SearchStructureParallel(const char * content, int64_t size, ThreadPool * thread_pool_p, std::vector<int64_t> * structure_table_p)
+{
+	// Fill "structure_table_p" with the locations of the structural characters which the sequential traversal in function "Preprocess" stops at.
+	// Each chunk is searched in 2 ways on its own thread, because the last character of the previous chunk may begin a pair ("\r\n", "\x2F\x2A" or "\x2A\x2F") which swallows the first character of this chunk:
+	// - way 0: beginning at the first character
+	// - way 1: beginning at the second character, until it joins way 0
+	// The right way of each chunk is selected sequentially according to the end of the previous one.
+	if (NULL == content)
+	{
+		throw std::exception("Function \"void Scanner::s_SearchStructureParallel(const char * content, int64_t size, ThreadPool * thread_pool_p, std::vector<int64_t> * structure_table_p)\" says: Invalid parameter \"content\".");
+	}
+	if (NULL == thread_pool_p)
+	{
+		throw std::exception("Function \"void Scanner::s_SearchStructureParallel(const char * content, int64_t size, ThreadPool * thread_pool_p, std::vector<int64_t> * structure_table_p)\" says: Invalid parameter \"thread_pool_p\".");
+	}
+	if (NULL == structure_table_p)
+	{
+		throw std::exception("Function \"void Scanner::s_SearchStructureParallel(const char * content, int64_t size, ThreadPool * thread_pool_p, std::vector<int64_t> * structure_table_p)\" says: Invalid parameter \"structure_table_p\".");
+	}
+	int64_t chunk_number = size / c_chunk_size_;
+	if (chunk_number > thread_pool_p->thread_number_ * 4)
+	{
+		chunk_number = thread_pool_p->thread_number_ * 4;
+	}
+	if (chunk_number < 1)
+	{
+		chunk_number = 1;
+	}
+	int64_t chunk_size = (size + chunk_number - 1) / chunk_number;
+	chunk_number = (size + chunk_size - 1) / chunk_size;
+	std::vector<std::vector<int64_t> > table_0(chunk_number);
+	std::vector<std::vector<int64_t> > table_1(chunk_number);
+	std::vector<int64_t> end_0(chunk_number);
+	std::vector<int64_t> end_1(chunk_number);
+	std::vector<int64_t> join_index(chunk_number, -1);
+	std::vector<int64_t> selection(chunk_number);
+	std::vector<int64_t> offset(chunk_number + 1);
+	// step 1: search each chunk
+	thread_pool_p->ParallelFor(chunk_number, [&](int64_t i)
+	{
+		int64_t beginning = i * chunk_size;
+		int64_t end = beginning + chunk_size < size ? beginning + chunk_size : size;
+		end_0[i] = s_SearchStructureChunk(content, beginning, end, size, NULL, NULL, &(table_0[i]));
+		if (i > 0)
+		{
+			end_1[i] = s_SearchStructureChunk(content, beginning + 1, end, size, &(table_0[i]), &(join_index[i]), &(table_1[i]));
+			if (join_index[i] >= 0)
+			{
+				end_1[i] = end_0[i];
+			}
+		}
+	});
+	// step 2: select the way of each chunk
+	int64_t next = 0;
+	offset[0] = 0;
+	for (int64_t i = 0; i < chunk_number; ++i)
+	{
+		selection[i] = next - i * chunk_size;
+		if (0 == selection[i])
+		{
+			offset[i + 1] = offset[i] + table_0[i].size();
+			next = end_0[i];
+		}
+		else
+		{
+			offset[i + 1] = offset[i] + table_1[i].size();
+			if (join_index[i] >= 0)
+			{
+				offset[i + 1] += table_0[i].size() - join_index[i];
+			}
+			next = end_1[i];
+		}
+	}
+	// step 3: merge
+	structure_table_p->resize(offset[chunk_number]);
+	thread_pool_p->ParallelFor(chunk_number, [&](int64_t i)
+	{
+		int64_t * destination = structure_table_p->empty() ? NULL : &((*structure_table_p)[0]) + offset[i];
+		if (0 == selection[i])
+		{
+			for (int64_t j = 0; j < table_0[i].size(); ++j)
+			{
+				*(destination++) = table_0[i][j];
+			}
+		}
+		else
+		{
+			for (int64_t j = 0; j < table_1[i].size(); ++j)
+			{
+				*(destination++) = table_1[i][j];
+			}
+			for (int64_t j = join_index[i]; j >= 0 && j < table_0[i].size(); ++j)
+			{
+				*(destination++) = table_0[i][j];
+			}
+		}
+	});
+}
+
+bool Scanner::s_IsPair(const char * content, int64_t index, int64_t size)
+{
+	// a pair of structural characters which is treated as a whole in function "Preprocess"
+	if (index + 1 >= size)
+	{
+		return false;
+	}
+	switch (content[index])
+	{
+	case '\r':
+		return '\n' == content[index + 1];
+	case '/':
+		return '*' == content[index + 1];
+	case '*':
+		return '/' == content[index + 1];
+	default:
+		return false;
+	}
+}
+
+int64_t Scanner::s_SearchStructureChunk(const char * content, int64_t index, int64_t end, int64_t size, const std::vector<int64_t> * join_table_p, int64_t * join_index_p, std::vector<int64_t> * structure_table_p)
+{
+	// Search [index, end) and return the location where the next chunk should begin (end or end + 1).
+	// If "join_table_p" is not NULL, stop as soon as a location in it is reached, and set "join_index_p" to its index.
+	int64_t join_index = 0;
+	while (index < end)
+	{
+		index = s_SearchStructure(content, index, end);
+		if (index >= end)
+		{
+			break;
+		}
+		if (NULL != join_table_p)
+		{
+			while (join_index < join_table_p->size() && (*join_table_p)[join_index] < index)
+			{
+				join_index += 1;
+			}
+			if (join_index < join_table_p->size() && (*join_table_p)[join_index] == index)
+			{
+				*join_index_p = join_index;
+				return -1;
+			}
+		}
+		structure_table_p->push_back(index);
+		index += s_IsPair(content, index, size) ? 2 : 1;
+	}
+	return index;
+}
+
+bool Scanner::s_IsRun(char ch, int64_t run)
+{
+	switch (run)
+	{
+	case c_run_blank_:
+		return ' ' == ch || '\t' == ch || '\r' == ch || '\n' == ch;
+	case c_run_digit_:
+		return ch >= '0' && ch <= '9';
+	case c_run_identifier_:
+		return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') || '_' == ch;
+	default:
+		throw std::exception("Function \"bool Scanner::s_IsRun(char ch, int64_t run)\" says: Invalid parameter \"run\".");
+	}
+}
+
+int64_t Scanner::s_SearchRunEnd(const char * content, int64_t index, int64_t size, int64_t run)
+{
+	// Return the location of the first character out of the run beginning at "index" in [index, size), or "size" if the run reaches it.
+	if (NULL == content)
+	{
+		throw std::exception("Function \"int64_t Scanner::s_SearchRunEnd(const char * content, int64_t index, int64_t size, int64_t run)\" says: Invalid parameter \"content\".");
+	}
+	// Most runs are short, so the first characters are checked one by one.
+	for (int64_t i = 0; i < 8 && index < size; ++i, ++index)
+	{
+		if (false == s_IsRun(content[index], run))
+		{
+			return index;
+		}
+	}
+#ifdef SCANNER_AVX2_
+	// 32 characters per step
+	uint32_t mask_32;
+	for (; c_simd_avx2_ == s_simd_ && index + 32 <= size; index += 32)
+	{
+		mask_32 = ~(uint32_t)_mm256_movemask_epi8(s_MatchRun(_mm256_loadu_si256((const __m256i *)(content + index)), run));
+		if (0 != mask_32)
+		{
+			return index + s_FirstBit(mask_32);
+		}
+	}
+#endif
+#ifdef SCANNER_SSE2_
+	// 16 characters per step
+	uint32_t mask;
+	for (; s_simd_ >= c_simd_sse2_ && index + 16 <= size; index += 16)
+	{
+		mask = ~(uint32_t)_mm_movemask_epi8(s_MatchRun(_mm_loadu_si128((const __m128i *)(content + index)), run)) & 0xFFFF;
+		if (0 != mask)
+		{
+			return index + s_FirstBit(mask);
+		}
+	}
+#endif
+	// the remaining part (or all, without SIMD)
+	for (; index < size; ++index)
+	{
+		if (false == s_IsRun(content[index], run))
+		{
+			return index;
+		}
+	}
+	return size;
+}
+
+#ifdef SCANNER_SSE2_
+__m128i Scanner::s_MatchRun(__m128i block, int64_t run)
+{
+	// 0xFF for each character in the run. Characters above 0x7F are negative, so they are out of every range.
+	__m128i match;
+	__m128i lower;
+	switch (run)
+	{
+	case c_run_blank_:
+		match = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, _mm_set1_epi8('\r')));
+		return _mm_or_si128(match, _mm_cmpeq_epi8(block, _mm_set1_epi8('\n')));
+	case c_run_digit_:
+		return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+	case c_run_identifier_:
+		match = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+		match = _mm_or_si128(match, _mm_cmpeq_epi8(block, _mm_set1_epi8('_')));
+		// 'A' - 'Z' and 'a' - 'z' are the same with bit 0x20 set.
+		lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+		return _mm_or_si128(match, _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1))));
+	default:
+		throw std::exception("Function \"__m128i Scanner::s_MatchRun(__m128i block, int64_t run)\" says: Invalid parameter \"run\".");
+	}
+}
+#endif
+
+#ifdef SCANNER_AVX2_
+__m256i Scanner::s_MatchRun(__m256i block, int64_t run)
+{
+	// 0xFF for each character in the run. Characters above 0x7F are negative, so they are out of every range.
+	__m256i match;
+	__m256i lower;
+	switch (run)
+	{
+	case c_run_blank_:
+		match = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t')));
+		match = _mm256_or_si256(match, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r')));
+		return _mm256_or_si256(match, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n')));
+	case c_run_digit_:
+		return _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), block));
+	case c_run_identifier_:
+		match = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), block));
+		match = _mm256_or_si256(match, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('_')));
+		// 'A' - 'Z' and 'a' - 'z' are the same with bit 0x20 set.
+		lower = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+		return _mm256_or_si256(match, _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower)));
+	default:
+		throw std::exception("Function \"__m256i Scanner::s_MatchRun(__m256i block, int64_t run)\" says: Invalid parameter \"run\".");
+	}
+}
+#endif
+
+int64_t Scanner::s_FirstBit(uint32_t mask)
+{
+	// "mask" should not be 0.
+#ifdef _MSC_VER
+	unsigned long bit;
+	_BitScanForward(&bit, mask);
+	return bit;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+#endif
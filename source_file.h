@@ -4,7 +4,18 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <vector>
+#include <algorithm>
 #include <exception>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "annotation_item.h"
 
 class SourceFile
@@ -13,27 +24,43 @@ public:
 	SourceFile();
 	~SourceFile();
 	void * Malloc(int64_t size);
+	int64_t Map(const char * path);
 	void Free();
 	void ReadyToMove();
 	void JumpTo(int64_t location);
 	int64_t MoveNext();
-	// content
-	char * content_;
+	void LocateLine();
+	int64_t ToShadow(int64_t location);
+	int64_t FromShadow(int64_t shadow_index);
+	// content: It is a read-only view of the source file if it is mapped, and it is not terminated by '\0' in that case.
+	const char * content_;
 	int64_t content_size_;
 	int64_t index_;
-	// line
+	// line: "line_index_" and "line_" are not maintained while moving. Call function "LocateLine" to get them.
 	std::vector<int64_t> line_table_;
 	int64_t line_size_;
 	int64_t line_index_;
 	int64_t line_;
 	// annotation
 	std::vector<AnnotationItem *> annotation_table_;
+	std::vector<int64_t> annotation_beginning_table_; // It is sorted, for binary search.
 	int64_t annotation_size_;
 	int64_t annotation_index_;
 	bool annotation_;
+	// shadow: the content without annotations, for lexical analysis. It is terminated by '\0' if any annotation is removed.
+	const char * shadow_;
+	int64_t shadow_size_;
 private:
+	void BuildShadow();
 	// lock of moving
 	bool move_enabled_;
+	// "content_" is a mapped view (true) or allocated on heap (false)
+	bool mapped_;
+	// shadow
+	std::vector<char> shadow_buffer_;
+	// segment: characters between annotations, which are put together in the shadow
+	std::vector<int64_t> segment_table_; // beginning in the content
+	std::vector<int64_t> segment_shadow_table_; // beginning in the shadow, and "shadow_size_" at the end
 };
 
 SourceFile::SourceFile()
@@ -47,7 +74,10 @@ SourceFile::SourceFile()
 	annotation_size_ = -1;
 	annotation_index_ = -2;
 	annotation_ = false;
+	shadow_ = NULL;
+	shadow_size_ = 0;
 	move_enabled_ = false;
+	mapped_ = false;
 }
 
 SourceFile::~SourceFile()
@@ -67,15 +97,96 @@ void * SourceFile::Malloc(int64_t size)
 		throw std::exception("Function \"void * SourceFile::Malloc(int64_t size)\" says: Invalid parameter \"size\".");
 	}
 	Free();
-	content_ = new char[size];
-	return content_;
+	char * content = new char[size];
+	content_ = content;
+	return content;
+}
+
+int64_t SourceFile::Map(const char * path)
+{
+	// Return 0 if the file can not be mapped (pipe, empty file, etc.). The caller should read it into heap instead.
+	if (NULL == path)
+	{
+		throw std::exception("Function \"int64_t SourceFile::Map(const char * path)\" says: Invalid parameter \"path\".");
+	}
+	Free();
+#ifdef _WIN32
+	HANDLE file_handle;
+	HANDLE mapping_handle;
+	LARGE_INTEGER size;
+	void * view;
+	// "FILE_FLAG_SEQUENTIAL_SCAN" is the hint of sequential access.
+	file_handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (INVALID_HANDLE_VALUE == file_handle)
+	{
+		return 0;
+	}
+	if (FILE_TYPE_DISK != GetFileType(file_handle) || FALSE == GetFileSizeEx(file_handle, &size) || size.QuadPart <= 0)
+	{
+		CloseHandle(file_handle);
+		return 0;
+	}
+	mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (NULL == mapping_handle)
+	{
+		CloseHandle(file_handle);
+		return 0;
+	}
+	view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+	// The view keeps the mapping alive, so handles could be closed now.
+	CloseHandle(mapping_handle);
+	CloseHandle(file_handle);
+	if (NULL == view)
+	{
+		return 0;
+	}
+	content_size_ = size.QuadPart;
+#else
+	int file_descriptor;
+	struct stat status;
+	void * view;
+	file_descriptor = open(path, O_RDONLY);
+	if (-1 == file_descriptor)
+	{
+		return 0;
+	}
+	if (-1 == fstat(file_descriptor, &status) || !S_ISREG(status.st_mode) || status.st_size <= 0)
+	{
+		close(file_descriptor);
+		return 0;
+	}
+	view = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	// The view keeps the file alive, so the descriptor could be closed now.
+	close(file_descriptor);
+	if (MAP_FAILED == view)
+	{
+		return 0;
+	}
+	madvise(view, status.st_size, MADV_SEQUENTIAL);
+	content_size_ = status.st_size;
+#endif
+	content_ = (const char *)view;
+	mapped_ = true;
+	return 1;
 }
 
 void SourceFile::Free()
 {
 	if (NULL != content_)
 	{
-		delete[] content_;
+		if (mapped_)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(content_);
+#else
+			munmap((void *)content_, content_size_);
+#endif
+			mapped_ = false;
+		}
+		else
+		{
+			delete[] content_;
+		}
 		content_ = NULL;
 	}
 }
@@ -84,6 +195,14 @@ void SourceFile::ReadyToMove()
 {
 	// unlock
 	move_enabled_ = true;
+	// index of annotation
+	annotation_beginning_table_.resize(annotation_size_ > 0 ? annotation_size_ : 0);
+	for (int64_t i = 0; i < annotation_size_; ++i)
+	{
+		annotation_beginning_table_[i] = annotation_table_[i]->beginning_;
+	}
+	// shadow
+	BuildShadow();
 	// jump to the beginning
 	JumpTo(0);
 }
@@ -100,21 +219,6 @@ void SourceFile::JumpTo(int64_t location)
 	}
 	// content index
 	index_ = location;
-	// line
-	line_index_ = 0;
-	for (int64_t i = 0; i < line_size_; ++i)
-	{
-		if (location >= line_table_[line_index_])
-		{
-			line_index_ += 1;
-		}
-		else
-		{
-			break;
-		}
-	}
-	line_index_ -= 1;
-	line_ = line_table_[line_index_];
 	// annotation
 	if (0 == annotation_size_)
 	{
@@ -124,19 +228,8 @@ void SourceFile::JumpTo(int64_t location)
 	}
 	else
 	{
-		annotation_index_ = 0;
-		for (int64_t i = 0; i < annotation_size_; ++i)
-		{
-			if (location >= annotation_table_[annotation_index_]->beginning_)
-			{
-				annotation_index_ += 1;
-			}
-			else
-			{
-				break;
-			}
-		}
-		annotation_index_ -= 1;
+		// the last annotation which begins before (or at) the location
+		annotation_index_ = std::upper_bound(annotation_beginning_table_.begin(), annotation_beginning_table_.end(), location) - annotation_beginning_table_.begin() - 1;
 		if (annotation_index_ >= 0)
 		{
 			// There is an annotation at the beginning of the source file.
@@ -168,12 +261,6 @@ int64_t SourceFile::MoveNext()
 	}
 	// move
 	index_ += 1;
-	// line
-	if (line_index_ + 1 < line_size_ && index_ >= line_table_[line_index_ + 1])
-	{
-		line_index_ += 1;
-		line_ = line_table_[line_index_];
-	}
 	// annotation
 	if (-2 != annotation_index_)
 	{
@@ -198,4 +285,94 @@ int64_t SourceFile::MoveNext()
 	return 1;
 }
 
+void SourceFile::LocateLine()
+{
+	// the last line which begins before (or at) "index_"
+	if (0 == line_size_)
+	{
+		return;
+	}
+	line_index_ = std::upper_bound(line_table_.begin(), line_table_.begin() + line_size_, index_) - line_table_.begin() - 1;
+	line_ = line_table_[line_index_];
+}
+
+int64_t SourceFile::ToShadow(int64_t location)
+{
+	// Return the location in the shadow of the first character out of annotations at (or after) "location" in the content.
+	if (false == move_enabled_)
+	{
+		throw std::exception("Function \"int64_t SourceFile::ToShadow(int64_t location)\" says: You should call function \"void SourceFile::ReadyToMove()\" first.");
+	}
+	if (location < 0 || location > content_size_ - 1)
+	{
+		throw std::exception("Function \"int64_t SourceFile::ToShadow(int64_t location)\" says: Invalid parameter \"location\".");
+	}
+	int64_t segment = std::upper_bound(segment_table_.begin(), segment_table_.end(), location) - segment_table_.begin() - 1;
+	int64_t offset = location - segment_table_[segment];
+	int64_t length = segment_shadow_table_[segment + 1] - segment_shadow_table_[segment];
+	// in the annotation behind the segment
+	if (offset > length)
+	{
+		offset = length;
+	}
+	return segment_shadow_table_[segment] + offset;
+}
+
+int64_t SourceFile::FromShadow(int64_t shadow_index)
+{
+	// Return the location in the content of a character in the shadow. The end of the shadow is mapped to the final character.
+	if (false == move_enabled_)
+	{
+		throw std::exception("Function \"int64_t SourceFile::FromShadow(int64_t shadow_index)\" says: You should call function \"void SourceFile::ReadyToMove()\" first.");
+	}
+	if (shadow_index < 0 || shadow_index > shadow_size_)
+	{
+		throw std::exception("Function \"int64_t SourceFile::FromShadow(int64_t shadow_index)\" says: Invalid parameter \"shadow_index\".");
+	}
+	// Empty segments (between adjacent annotations) are skipped by searching the last one.
+	int64_t segment = std::upper_bound(segment_shadow_table_.begin(), segment_shadow_table_.end() - 1, shadow_index) - segment_shadow_table_.begin() - 1;
+	int64_t location = segment_table_[segment] + shadow_index - segment_shadow_table_[segment];
+	if (location > content_size_ - 1)
+	{
+		location = content_size_ - 1;
+	}
+	return location;
+}
+
+void SourceFile::BuildShadow()
+{
+	int64_t beginning = 0;
+	int64_t end;
+	segment_table_.clear();
+	segment_shadow_table_.clear();
+	shadow_buffer_.clear();
+	if (annotation_size_ <= 0)
+	{
+		// No annotation exists. The shadow is the content itself.
+		shadow_ = content_;
+		shadow_size_ = content_size_;
+		segment_table_.push_back(0);
+		segment_shadow_table_.push_back(0);
+		segment_shadow_table_.push_back(content_size_);
+		return;
+	}
+	shadow_buffer_.reserve(content_size_ + 1);
+	for (int64_t i = 0; i <= annotation_size_; ++i)
+	{
+		end = i < annotation_size_ ? annotation_table_[i]->beginning_ : content_size_;
+		segment_table_.push_back(beginning);
+		segment_shadow_table_.push_back(shadow_buffer_.size());
+		shadow_buffer_.insert(shadow_buffer_.end(), content_ + beginning, content_ + end);
+		if (i < annotation_size_)
+		{
+			// An outer annotation of nested ones is never closed, and only its first character is skipped by function "MoveNext".
+			beginning = annotation_table_[i]->end_ > annotation_table_[i]->beginning_ ? annotation_table_[i]->end_ + 1 : annotation_table_[i]->beginning_ + 1;
+		}
+	}
+	segment_shadow_table_.push_back(shadow_buffer_.size());
+	shadow_size_ = shadow_buffer_.size();
+	shadow_buffer_.push_back('\0');
+	shadow_ = &(shadow_buffer_[0]);
+}
+
 #endif
@@ -0,0 +1,152 @@
+#ifndef SYMBOL_TABLE_H_
+#define SYMBOL_TABLE_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include <exception>
+#include <mutex>
+#include <atomic>
+#include "variable_item.h"
+#include "block.h"
+#include "block_tree.h"
+
+class SymbolTable
+{
+public:
+	// page of variables (indexed by id): Pages are never moved, so a variable is read without lock while others are inserted.
+	static const int64_t c_page_size_ = 4096;
+	static const int64_t c_page_number_ = 65536;
+	SymbolTable(BlockTree * block_tree_p);
+	~SymbolTable();
+	int32_t Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter);
+	int32_t Search(int32_t name_id, int64_t block, bool is_parameter_searched);
+	VariableItem * GetVariable(int32_t id);
+	void Clear();
+	// number of ids: Ids are dense, from 0 to "size_ - 1".
+	std::atomic<int32_t> size_;
+private:
+	// Names are kept in the scope of each block (see "block.h"). Blocks are parsed in parallel, and a block only inserts into its own scope and searches the scopes of its ancestors, which are parsed before it.
+	SymbolTable(const SymbolTable &);
+	SymbolTable & operator=(const SymbolTable &);
+	BlockTree * block_tree_;
+	std::vector<VariableItem **> page_table_;
+	std::mutex page_mutex_;
+};
+
+SymbolTable::SymbolTable(BlockTree * block_tree_p)
+{
+	if (NULL == block_tree_p)
+	{
+		throw std::exception("Function \"SymbolTable::SymbolTable(BlockTree * block_tree_p)\" says: Invalid parameter \"block_tree_p\".");
+	}
+	block_tree_ = block_tree_p;
+	size_ = 0;
+	page_table_.assign(c_page_number_, NULL);
+}
+
+SymbolTable::~SymbolTable()
+{
+	Clear();
+}
+
+int32_t SymbolTable::Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter)
+{
+	// Return the id of the variable.
+	if (name_id < 0)
+	{
+		throw std::exception("Function \"int32_t SymbolTable::Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter)\" says: Invalid parameter \"name_id\".");
+	}
+	if (block < 0 || block >= block_tree_->size_)
+	{
+		throw std::exception("Function \"int32_t SymbolTable::Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter)\" says: Invalid parameter \"block\".");
+	}
+	if (NULL == variable_item_p)
+	{
+		throw std::exception("Function \"int32_t SymbolTable::Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter)\" says: Invalid parameter \"variable_item_p\".");
+	}
+	int32_t id = size_++;
+	if (id >= c_page_size_ * c_page_number_)
+	{
+		throw std::exception("Function \"int32_t SymbolTable::Insert(int32_t name_id, int64_t block, VariableItem * variable_item_p, bool is_parameter)\" says: Too many variables.");
+	}
+	{
+		std::unique_lock<std::mutex> page_lock(page_mutex_);
+		if (NULL == page_table_[id / c_page_size_])
+		{
+			page_table_[id / c_page_size_] = new VariableItem *[c_page_size_];
+		}
+	}
+	page_table_[id / c_page_size_][id % c_page_size_] = variable_item_p;
+	// The first one with the name in a block is kept.
+	Block * block_p = block_tree_->block_table_[block];
+	if (is_parameter)
+	{
+		block_p->parameter_scope_table_.insert(std::make_pair(name_id, id));
+	}
+	else
+	{
+		block_p->variable_scope_table_.insert(std::make_pair(name_id, id));
+	}
+	return id;
+}
+
+int32_t SymbolTable::Search(int32_t name_id, int64_t block, bool is_parameter_searched)
+{
+	// Return the id of the variable defined in the nearest block of "block" and its ancestors (the first one in a block), else the parameter (if searched), else -1.
+	if (block < 0 || block >= block_tree_->size_)
+	{
+		throw std::exception("Function \"int32_t SymbolTable::Search(int32_t name_id, int64_t block, bool is_parameter_searched)\" says: Invalid parameter \"block\".");
+	}
+	if (name_id < 0)
+	{
+		// not an identifier
+		return -1;
+	}
+	std::unordered_map<int32_t, int32_t> * scope_p;
+	std::unordered_map<int32_t, int32_t>::iterator it;
+	for (int64_t i = block; BlockTree::c_none_ != i; i = block_tree_->parent_table_[i])
+	{
+		scope_p = &(block_tree_->block_table_[i]->variable_scope_table_);
+		it = scope_p->find(name_id);
+		if (it != scope_p->end())
+		{
+			return it->second;
+		}
+	}
+	if (false == is_parameter_searched)
+	{
+		return -1;
+	}
+	scope_p = &(block_tree_->block_table_[block_tree_->root_table_[block]]->parameter_scope_table_);
+	it = scope_p->find(name_id);
+	return it != scope_p->end() ? it->second : -1;
+}
+
+VariableItem * SymbolTable::GetVariable(int32_t id)
+{
+	if (id < 0 || id >= size_)
+	{
+		throw std::exception("Function \"VariableItem * SymbolTable::GetVariable(int32_t id)\" says: Invalid parameter \"id\".");
+	}
+	return page_table_[id / c_page_size_][id % c_page_size_];
+}
+
+void SymbolTable::Clear()
+{
+	// The scopes are freed with the blocks.
+	for (int64_t i = 0; i < c_page_number_; ++i)
+	{
+		if (page_table_[i] != NULL)
+		{
+			delete[] page_table_[i];
+			page_table_[i] = NULL;
+		}
+	}
+	size_ = 0;
+}
+
+#endif
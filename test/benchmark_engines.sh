@@ -0,0 +1,85 @@
+#!/bin/bash
+# Throughput of the engines of parsing blocks, side by side: Generate a large source file, compile it with "-e precedence" and with "-e pratt" on one thread, and show the best time of several runs.
+# The generated file is the same for the same numbers. The other steps of the compiler are the same for both engines, so the difference of time is the difference of parsing.
+# usage: test/benchmark_engines.sh [compiler] [number of functions] [number of statements in a function] [number of runs]
+
+compiler=${1:-./C-like-compiler}
+function_number=${2:-1000}
+statement_number=${3:-1000}
+run_number=${4:-3}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+source="$work_directory/benchmark.c"
+# Each function calls the one before it, and "main" is the last one. Statements come in turn from the forms below.
+awk -v function_number=$function_number -v statement_number=$statement_number 'BEGIN {
+	for (f = 0; f < function_number; ++f)
+	{
+		if (f == function_number - 1)
+		{
+			print "void main()"
+		}
+		else
+		{
+			print "int f" f "(int p, int q)"
+		}
+		print "{"
+		print "\tint a;"
+		print "\tint b;"
+		print "\tint c;"
+		for (s = 0; s < statement_number; ++s)
+		{
+			k = s % 8
+			if (0 == k) print "\ta = a + b * c - a / b % c;"
+			else if (1 == k) print "\tb = ((a + b) * (c - a)) % 7;"
+			else if (2 == k) print "\tc = a * -3 + -12 / b;"
+			else if (3 == k) print "\tif (a < b)\n\t{\n\t\ta = a - 1;\n\t}\n\telse\n\t{\n\t\tb = b + 1;\n\t}"
+			else if (4 == k) print "\twhile (c > a)\n\t{\n\t\tc = c - 2;\n\t}"
+			else if (5 == k && f > 0) print "\ta = $ f" (f - 1) "(a, b) $;"
+			else if (5 == k) print "\ta = b;"
+			else if (6 == k) print "\tinput $$ a $$;"
+			else print "\toutput $$ c $$;"
+		}
+		if (f < function_number - 1)
+		{
+			print "\treturn p;"
+		}
+		print "}"
+		print ""
+	}
+}' > "$source"
+size=$(wc -c < "$source")
+echo "source file: $function_number functions, $statement_number statements in each, $size bytes"
+for engine in precedence pratt
+do
+	best=0
+	for ((i = 0; i < run_number; ++i))
+	do
+		beginning=$(date +%s%N)
+		"$compiler" -e $engine -j 1 "$source" "$work_directory/$engine.i" > "$work_directory/$engine.out" 2> /dev/null
+		end=$(date +%s%N)
+		if [ ! -f "$work_directory/$engine.i" ]
+		then
+			echo "The engine \"$engine\" fails:"
+			grep '^\[0x' "$work_directory/$engine.out"
+			exit 1
+		fi
+		time=$(((end - beginning) / 1000000))
+		if [ 0 -eq $i ] || [ $time -lt $best ]
+		then
+			best=$time
+		fi
+	done
+	echo "$engine: $best ms (best of $run_number runs), $(awk -v size=$size -v time=$best 'BEGIN { printf "%.2f", size / 1048576 / (time > 0 ? time / 1000 : 0.001) }') MB/s"
+done
+if cmp -s "$work_directory/precedence.i" "$work_directory/pratt.i"
+then
+	echo "The intermediate files are the same."
+else
+	echo "The intermediate files are different."
+	exit 1
+fi
@@ -0,0 +1,274 @@
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+#include "../lexical_table.h"
+
+// Microbenchmark of the DFA in lexical analysis: the tables in "lexical_table.h" against the switch of states (0, 101, 199, 201, ...) which function "LexicalAnalyse" used before them.
+// Both DFAs read the same generated text and must give the same words (beginning, length and type).
+// - The text is like a large block without child blocks, so "{" and "}" are only separators.
+// - Blanks are words in both, as they were in the switch lexer, and runs are not skipped (Function "LexicalAnalyse" skips them with "Scanner" now.), so only the DFAs are compared.
+// - The switch lexer copied each char into a buffer of the word, so it does here too.
+// It is built as a separate program, as the optimizer is.
+// usage: benchmark_lexer [size of the text in MB] [number of runs]
+
+void GenerateText(int64_t size, std::vector<char> * text_p);
+int64_t LexBySwitch(const char * text, int64_t size, std::vector<int64_t> * word_table_p);
+int64_t LexByTable(const char * text, int64_t size, std::vector<int64_t> * word_table_p);
+
+int main(int argc, char ** argv)
+{
+	int64_t size_mb = argc > 1 ? atoi(argv[1]) : 64;
+	int64_t run_number = argc > 2 ? atoi(argv[2]) : 3;
+	std::vector<char> text;
+	// words: beginning, length and type of each one
+	std::vector<int64_t> switch_word_table;
+	std::vector<int64_t> table_word_table;
+	int64_t word_number;
+	double second;
+	double best;
+	std::chrono::steady_clock::time_point beginning;
+	if (size_mb <= 0 || run_number <= 0)
+	{
+		printf("usage: benchmark_lexer [size of the text in MB] [number of runs]\n");
+		return 1;
+	}
+	GenerateText(size_mb * 1048576, &text);
+	printf("text: %I64d bytes\n", (int64_t)text.size());
+	for (int64_t lexer = 0; lexer < 2; ++lexer)
+	{
+		best = 0;
+		for (int64_t i = 0; i < run_number; ++i)
+		{
+			beginning = std::chrono::steady_clock::now();
+			if (0 == lexer)
+			{
+				word_number = LexBySwitch(&(text[0]), text.size(), &switch_word_table);
+			}
+			else
+			{
+				word_number = LexByTable(&(text[0]), text.size(), &table_word_table);
+			}
+			second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+			if (-1 == word_number)
+			{
+				printf("There is an illegal character in the text.\n");
+				return 1;
+			}
+			if (0 == i || second < best)
+			{
+				best = second;
+			}
+		}
+		printf("%s: %.2f ms (best of %I64d runs), %.1f MB/s, %I64d words\n", 0 == lexer ? "switch" : "table", best * 1000, run_number, best > 0 ? text.size() / best / 1048576 : 0.0, word_number);
+	}
+	if (switch_word_table != table_word_table)
+	{
+		printf("The words are different.\n");
+		return 1;
+	}
+	printf("The words are the same.\n");
+	return 0;
+}
+
+void GenerateText(int64_t size, std::vector<char> * text_p)
+{
+	// statements in turn, as "test/benchmark_engines.sh" generates
+	const char * statement_table[] =
+	{
+		"\ta = a + b * c - a / b % c;\n",
+		"\tb = ((a + b) * (c - a)) % 7;\n",
+		"\tc = a * -3 + -12 / b;\n",
+		"\tif (a < b)\n\t{\n\t\ta = a - 1;\n\t}\n\telse\n\t{\n\t\tb = b + 1;\n\t}\n",
+		"\twhile (c > a)\n\t{\n\t\tc = c - 2;\n\t}\n",
+		"\tresult_of_the_function = $ function_with_a_long_name(a, 1024) $;\n",
+		"\tinput $$ a $$;\n",
+		"\toutput $$ c $$;\n"
+	};
+	const char * statement;
+	text_p->clear();
+	for (int64_t i = 0; text_p->size() < size; ++i)
+	{
+		for (statement = statement_table[i % 8]; '\0' != *statement; ++statement)
+		{
+			text_p->push_back(*statement);
+		}
+	}
+}
+
+int64_t LexBySwitch(const char * text, int64_t size, std::vector<int64_t> * word_table_p)
+{
+	// the switch lexer, without child blocks, annotations and keywords: Return the number of words, or -1 if there is an illegal character. The text should end with a blank, which ends the last word.
+	char buffer[1024];
+	int64_t buffer_index = 0;
+	int64_t index = 0;
+	int64_t status = 0;
+	int64_t type;
+	char ch = size > 0 ? text[0] : '\0';
+	word_table_p->clear();
+	while (index < size)
+	{
+		switch (status)
+		{
+		case 0:
+			if (ch >= '0' && ch <= '9')
+			{
+				buffer[buffer_index++] = ch;
+				status = '0' == ch ? 199 : 101;
+			}
+			else if ((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || '_' == ch)
+			{
+				buffer[buffer_index++] = ch;
+				status = 201;
+			}
+			else
+			{
+				switch (ch)
+				{
+				case '-':
+					buffer[buffer_index++] = ch;
+					status = 301;
+					break;
+				case '(':
+				case ')':
+				case '!':
+				case '*':
+				case '/':
+				case '%':
+				case '+':
+				case '<':
+				case '>':
+					buffer[buffer_index++] = ch;
+					status = 399;
+					break;
+				case '=':
+					buffer[buffer_index++] = ch;
+					status = 302;
+					break;
+				case '$':
+					buffer[buffer_index++] = ch;
+					status = 303;
+					break;
+				case ' ':
+				case '\t':
+				case '\r':
+				case '\n':
+				case ';':
+				case ',':
+				case '{':
+				case '}':
+					buffer[buffer_index++] = ch;
+					status = 499;
+					break;
+				default:
+					return -1;
+				}
+			}
+			break;
+		case 101:
+			buffer[buffer_index++] = ch;
+			status = ch >= '0' && ch <= '9' ? 101 : 198;
+			break;
+		case 201:
+			buffer[buffer_index++] = ch;
+			status = (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') || '_' == ch ? 201 : 299;
+			break;
+		case 301:
+			buffer[buffer_index++] = ch;
+			status = ch >= '1' && ch <= '9' ? 101 : 398;
+			break;
+		case 302:
+			buffer[buffer_index++] = ch;
+			status = '=' == ch ? 399 : 398;
+			break;
+		case 303:
+			buffer[buffer_index++] = ch;
+			status = '$' == ch ? 399 : 398;
+			break;
+		case 198:
+		case 299:
+		case 398:
+			// fallback a char
+			buffer_index -= 1;
+			index -= 1;
+			// no break
+		case 199:
+		case 399:
+		case 499:
+			// add a word: It ends at "index".
+			buffer[buffer_index] = '\0';
+			if (198 == status || 199 == status)
+			{
+				type = TokenStream::c_constant_int_;
+			}
+			else if (299 == status)
+			{
+				type = TokenStream::c_identifier_;
+			}
+			else if (499 == status)
+			{
+				type = TokenStream::c_separator_;
+			}
+			else
+			{
+				type = TokenStream::c_operator_;
+			}
+			word_table_p->push_back(index - buffer_index + 1);
+			word_table_p->push_back(buffer_index);
+			word_table_p->push_back(type);
+			buffer_index = 0;
+			status = 0;
+			break;
+		default:
+			return -1;
+		}
+		if (status != 198 && status != 199 && status != 299 && status != 398 && status != 399 && status != 499)
+		{
+			// move to the next char
+			index += 1;
+			ch = index < size ? text[index] : '\0';
+		}
+	}
+	return word_table_p->size() / 3;
+}
+
+int64_t LexByTable(const char * text, int64_t size, std::vector<int64_t> * word_table_p)
+{
+	// the loop of function "LexicalAnalyse_Range", without child blocks and runs: Return the number of words, or -1 if there is an illegal character. The text should end with a blank, which ends the last word.
+	int64_t status = LexicalTable::c_state_start_;
+	int64_t beginning = 0;
+	int64_t index = 0;
+	char ch;
+	word_table_p->clear();
+	while (index < size)
+	{
+		ch = text[index];
+		if (LexicalTable::c_state_start_ == status)
+		{
+			beginning = index;
+		}
+		status = LexicalTable::s_transition_table_[status][LexicalTable::s_class_table_[(unsigned char)ch]];
+		if (status < LexicalTable::c_state_accept_)
+		{
+			index += 1;
+			continue;
+		}
+		if (LexicalTable::c_state_illegal_ == status)
+		{
+			return -1;
+		}
+		// add a word: The char fallen back is not a part of it.
+		word_table_p->push_back(beginning);
+		word_table_p->push_back(LexicalTable::s_fallback_table_[status] ? index - beginning : index - beginning + 1);
+		word_table_p->push_back(LexicalTable::s_word_type_table_[status]);
+		if (false == LexicalTable::s_fallback_table_[status])
+		{
+			index += 1;
+		}
+		status = LexicalTable::c_state_start_;
+	}
+	return word_table_p->size() / 3;
+}
@@ -0,0 +1,88 @@
+#!/bin/bash
+# Throughput of writing the intermediate file ("WriteIntermediateFile"): Generate a large program, compile it with "-t" on one thread and on [number of threads], and show the best time of writing of several runs and the size of the intermediate file in MB/s.
+# The program is like the one of "test/benchmark_engines.sh", so most of the output is codes of expressions, branches and calls. The intermediate files must be the same for any number of threads.
+# usage: test/benchmark_output.sh [compiler] [number of functions] [number of statements in a function] [number of runs] [number of threads]
+
+compiler=${1:-./C-like-compiler}
+function_number=${2:-1000}
+statement_number=${3:-1000}
+run_number=${4:-3}
+thread_number=${5:-4}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+source="$work_directory/benchmark.c"
+# Each function calls the one before it, and "main" is the last one. Statements come in turn from the forms below.
+awk -v function_number=$function_number -v statement_number=$statement_number 'BEGIN {
+	for (f = 0; f < function_number; ++f)
+	{
+		if (f == function_number - 1)
+		{
+			print "void main()"
+		}
+		else
+		{
+			print "int f" f "(int p, int q)"
+		}
+		print "{"
+		print "\tint a;"
+		print "\tint b;"
+		print "\tint c;"
+		for (s = 0; s < statement_number; ++s)
+		{
+			k = s % 8
+			if (0 == k) print "\ta = a + b * c - a / b % c;"
+			else if (1 == k) print "\tb = ((a + b) * (c - a)) % 7;"
+			else if (2 == k) print "\tc = a * -3 + -12 / b;"
+			else if (3 == k) print "\tif (a < b)\n\t{\n\t\ta = a - 1;\n\t}\n\telse\n\t{\n\t\tb = b + 1;\n\t}"
+			else if (4 == k) print "\twhile (c > a)\n\t{\n\t\tc = c - 2;\n\t}"
+			else if (5 == k && f > 0) print "\ta = $ f" (f - 1) "(a, b) $;"
+			else if (5 == k) print "\ta = b;"
+			else if (6 == k) print "\tinput $$ a $$;"
+			else print "\toutput $$ c $$;"
+		}
+		if (f < function_number - 1)
+		{
+			print "\treturn p;"
+		}
+		print "}"
+		print ""
+	}
+}' > "$source"
+echo "source file: $function_number functions, $statement_number statements in each, $(wc -c < "$source") bytes"
+for j in 1 $thread_number
+do
+	best=""
+	for ((i = 0; i < run_number; ++i))
+	do
+		rm -f "$work_directory/$j.i"
+		"$compiler" -t -j $j "$source" "$work_directory/$j.i" > "$work_directory/$j.out" 2> /dev/null
+		if [ ! -f "$work_directory/$j.i" ]
+		then
+			echo "The compiler fails with \"-j $j\":"
+			grep '^\[0x' "$work_directory/$j.out"
+			exit 1
+		fi
+		time=$(awk '/^Write intermediate file:/ { print $4 }' "$work_directory/$j.out")
+		if [ -z "$best" ] || awk -v time=$time -v best=$best 'BEGIN { exit !(time < best) }'
+		then
+			best=$time
+		fi
+	done
+	size=$(wc -c < "$work_directory/$j.i")
+	echo "-j $j: $size bytes in $(awk -v time=$best 'BEGIN { printf "%.2f", time * 1000 }') ms (best of $run_number runs), $(awk -v size=$size -v time=$best 'BEGIN { printf "%.1f", size / 1000000 / (time > 0 ? time : 0.000001) }') MB/s"
+	if [ 1 -eq $j ]
+	then
+		continue
+	fi
+	if ! cmp -s "$work_directory/1.i" "$work_directory/$j.i"
+	then
+		echo "The intermediate files of 1 thread and $j threads are different."
+		exit 1
+	fi
+done
+echo "The intermediate files are the same."
@@ -0,0 +1,87 @@
+#!/bin/bash
+# Throughput of preprocessing with each SIMD of searching structural characters: Generate a large source file, compile it with "-s scalar", "-s sse2" and "-s avx2" on one thread, and show the best time of preprocessing of several runs in GB/s.
+# Most of the file is long annotations and long lines, where structural characters are few, as in a source file with documents. A SIMD which is not built in the compiler is skipped.
+# usage: test/benchmark_preprocess.sh [compiler] [size of the source file in MB] [number of runs]
+
+compiler=${1:-./C-like-compiler}
+size_mb=${2:-64}
+run_number=${3:-3}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+source="$work_directory/benchmark.c"
+# Each function (about 4 KB) has an annotation of 40 lines before it, and "main" is the last one.
+awk -v function_number=$((size_mb * 1048576 / 4096 + 1)) 'BEGIN {
+	for (f = 0; f < function_number; ++f)
+	{
+		print "/*"
+		for (l = 0; l < 40; ++l)
+		{
+			print "\tFunction f" f " returns the sum of its parameters p and q, which are integers; line " l " of its document."
+		}
+		print "*/"
+		if (f == function_number - 1)
+		{
+			print "void main()"
+			print "{"
+			print "\tint result_of_the_program;"
+			print "\tresult_of_the_program = 1;"
+			print "}"
+		}
+		else
+		{
+			print "int f" f "(int p, int q)"
+			print "{"
+			print "\tint sum_of_the_parameters;"
+			print "\tsum_of_the_parameters = p + q; /* the sum */"
+			print "\treturn sum_of_the_parameters;"
+			print "}"
+		}
+		print ""
+	}
+}' > "$source"
+size=$(wc -c < "$source")
+echo "source file: $size bytes"
+reference=""
+for simd in scalar sse2 avx2
+do
+	best=""
+	for ((i = 0; i < run_number; ++i))
+	do
+		"$compiler" -t -s $simd -j 1 "$source" "$work_directory/$simd.i" > "$work_directory/$simd.out" 2> /dev/null
+		if grep -q '^Unknown or not built SIMD' "$work_directory/$simd.out"
+		then
+			break
+		fi
+		if [ ! -f "$work_directory/$simd.i" ]
+		then
+			echo "The compiler fails with \"-s $simd\":"
+			grep '^\[0x' "$work_directory/$simd.out"
+			exit 1
+		fi
+		time=$(awk '/^Preprocess:/ { print $5 }' "$work_directory/$simd.out")
+		if [ -z "$best" ] || awk -v time=$time -v best=$best 'BEGIN { exit !(time < best) }'
+		then
+			best=$time
+		fi
+	done
+	if [ -z "$best" ]
+	then
+		echo "$simd: not built in the compiler"
+		continue
+	fi
+	echo "$simd: $(awk -v time=$best 'BEGIN { printf "%.2f", time * 1000 }') ms (best of $run_number runs), $(awk -v size=$size -v time=$best 'BEGIN { printf "%.2f", size / 1000000000 / (time > 0 ? time : 0.000001) }') GB/s"
+	if [ -z "$reference" ]
+	then
+		reference=$simd
+	elif ! cmp -s "$work_directory/$reference.i" "$work_directory/$simd.i"
+	then
+		echo "The intermediate files of \"$reference\" and \"$simd\" are different."
+		exit 1
+	fi
+done
+echo "The intermediate files are the same."
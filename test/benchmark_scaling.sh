@@ -0,0 +1,70 @@
+#!/bin/bash
+# Scaling of the precedence engine ("ParseBlock_Precedence") in the number of statements: Generate source files of 10^3, 10^4, 10^5 and 10^6 statements in "main", compile each with "-t -e precedence" on one thread, and show the best time of parsing blocks of several runs, and the time per statement.
+# The statements come in turn from the forms of "test/benchmark_engines.sh" (without calls), so a block and its statements grow together. The parsing is linear if the time per statement stays about the same; it fails if the time per statement of the largest file is more than [limit] times that of 10^4 statements (10^3 statements are too few to time well).
+# usage: test/benchmark_scaling.sh [compiler] [number of runs] [limit]
+
+compiler=${1:-./C-like-compiler}
+run_number=${2:-3}
+limit=${3:-2}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+reference=""
+for statement_number in 1000 10000 100000 1000000
+do
+	source="$work_directory/$statement_number.c"
+	awk -v statement_number=$statement_number 'BEGIN {
+		print "void main()"
+		print "{"
+		print "\tint a;"
+		print "\tint b;"
+		print "\tint c;"
+		for (s = 0; s < statement_number; ++s)
+		{
+			k = s % 8
+			if (0 == k) print "\ta = a + b * c - a / b % c;"
+			else if (1 == k) print "\tb = ((a + b) * (c - a)) % 7;"
+			else if (2 == k) print "\tc = a * -3 + -12 / b;"
+			else if (3 == k) print "\tif (a < b)\n\t{\n\t\ta = a - 1;\n\t}\n\telse\n\t{\n\t\tb = b + 1;\n\t}"
+			else if (4 == k) print "\twhile (c > a)\n\t{\n\t\tc = c - 2;\n\t}"
+			else if (5 == k) print "\ta = b;"
+			else if (6 == k) print "\tinput $$ a $$;"
+			else print "\toutput $$ c $$;"
+		}
+		print "}"
+	}' > "$source"
+	best=""
+	for ((i = 0; i < run_number; ++i))
+	do
+		rm -f "$work_directory/$statement_number.i"
+		"$compiler" -t -e precedence -j 1 "$source" "$work_directory/$statement_number.i" > "$work_directory/$statement_number.out" 2> /dev/null
+		if [ ! -f "$work_directory/$statement_number.i" ]
+		then
+			echo "The compiler fails with $statement_number statements:"
+			grep '^\[0x' "$work_directory/$statement_number.out"
+			exit 1
+		fi
+		time=$(awk '/^Parse blocks:/ { print $6 }' "$work_directory/$statement_number.out")
+		if [ -z "$best" ] || awk -v time=$time -v best=$best 'BEGIN { exit !(time < best) }'
+		then
+			best=$time
+		fi
+	done
+	per_statement=$(awk -v time=$best -v statement_number=$statement_number 'BEGIN { printf "%.1f", time * 1000000000 / statement_number }')
+	echo "$statement_number statements: $(wc -c < "$source") bytes, $(awk -v time=$best 'BEGIN { printf "%.2f", time * 1000 }') ms (best of $run_number runs), $per_statement ns/statement"
+	rm -f "$source" "$work_directory/$statement_number.i"
+	if [ 10000 -eq $statement_number ]
+	then
+		reference=$per_statement
+	fi
+done
+if awk -v last=$per_statement -v reference=$reference -v limit=$limit 'BEGIN { exit !(last > reference * limit) }'
+then
+	echo "The time per statement grows: $per_statement ns with 10^6 statements, against $reference ns with 10^4."
+	exit 1
+fi
+echo "The time of parsing is linear in the number of statements."
@@ -0,0 +1,362 @@
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <chrono>
+#include "../lexical_table.h"
+#include "../token_stream.h"
+
+// Benchmark of storing tokens: "TokenStream" (parallel arrays of views of the text) against the list of words which the compiler used before it (a node for each word, with a copy of its content).
+// Both get the same tokens of the same generated text from the DFA in "lexical_table.h", without blanks, as function "LexicalAnalyse" gives them to the parser.
+// - store: lexical analysis, and appending each token (Function "TokenStream::Append" looks up the symbol and interns identifiers; the list looked up keywords with "strcmp", as the lexer of words did.)
+// - walk: going forward and then backward over all tokens and reading the type and the first char of each one, as the parser does.
+// - bytes/token: the capacities of the arrays of "TokenStream", and a node and its content for the list (without the overhead of the allocator), not counting the text.
+// It is built as a separate program, as the optimizer is.
+// usage: benchmark_tokens [size of the text in MB] [number of runs]
+
+// the list of words, as in "word.h" before "TokenStream"
+class Word
+{
+public:
+	static Word * s_Insert(Word * it_next);
+	Word();
+	~Word();
+	void RemoveAllNext();
+	int64_t SetContent(const char * content, int64_t length);
+	// pointer
+	Word * previous_;
+	Word * next_;
+	// information
+	char * content_;
+	int64_t type_;
+	int64_t source_file_index_;
+};
+
+void GenerateText(int64_t size, std::vector<char> * text_p);
+int64_t StoreInTokenStream(const char * text, int64_t size, TokenStream * token_stream_p);
+int64_t StoreInList(const char * text, int64_t size, Word * head_p);
+int64_t WalkTokenStream(const TokenStream * token_stream_p);
+int64_t WalkList(const Word * head_p);
+bool CompareTokens(const TokenStream * token_stream_p, const Word * head_p);
+
+const char * const c_keyword_table[] = { "void", "int", "if", "else", "while", "return", "input", "output" };
+
+int main(int argc, char ** argv)
+{
+	int64_t size_mb = argc > 1 ? atoi(argv[1]) : 16;
+	int64_t run_number = argc > 2 ? atoi(argv[2]) : 3;
+	std::vector<char> text;
+	TokenStream token_stream;
+	Word head;
+	int64_t token_number;
+	int64_t sum[2] = { 0, 0 };
+	double byte_per_token;
+	double second;
+	double store_best;
+	double walk_best;
+	std::chrono::steady_clock::time_point beginning;
+	if (size_mb <= 0 || run_number <= 0)
+	{
+		printf("usage: benchmark_tokens [size of the text in MB] [number of runs]\n");
+		return 1;
+	}
+	GenerateText(size_mb * 1048576, &text);
+	printf("text: %I64d bytes\n", (int64_t)text.size());
+	for (int64_t storage = 0; storage < 2; ++storage)
+	{
+		store_best = 0;
+		walk_best = 0;
+		for (int64_t i = 0; i < run_number; ++i)
+		{
+			if (0 == storage)
+			{
+				token_stream = TokenStream();
+			}
+			else
+			{
+				head.RemoveAllNext();
+			}
+			beginning = std::chrono::steady_clock::now();
+			token_number = 0 == storage ? StoreInTokenStream(&(text[0]), text.size(), &token_stream) : StoreInList(&(text[0]), text.size(), &head);
+			second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+			if (-1 == token_number)
+			{
+				printf("There is an illegal character in the text.\n");
+				return 1;
+			}
+			if (0 == i || second < store_best)
+			{
+				store_best = second;
+			}
+			beginning = std::chrono::steady_clock::now();
+			sum[storage] = 0 == storage ? WalkTokenStream(&token_stream) : WalkList(&head);
+			second = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginning).count();
+			if (0 == i || second < walk_best)
+			{
+				walk_best = second;
+			}
+		}
+		if (0 == storage)
+		{
+			byte_per_token = (double)(token_stream.type_table_.capacity() * sizeof(unsigned char) + token_stream.symbol_table_.capacity() * sizeof(char) + token_stream.location_table_.capacity() * sizeof(int64_t) + token_stream.text_table_.capacity() * sizeof(int64_t) + token_stream.length_table_.capacity() * sizeof(int64_t) + token_stream.id_table_.capacity() * sizeof(int32_t)) / token_number;
+		}
+		else
+		{
+			byte_per_token = sizeof(Word);
+			for (const Word * it = head.next_; NULL != it; it = it->next_)
+			{
+				byte_per_token += (double)(strlen(it->content_) + 1) / token_number;
+			}
+		}
+		printf("%s: store %.2f ms, %.1f M tokens/s; walk %.2f ms, %.1f M tokens/s (best of %I64d runs); %.1f bytes/token, %I64d tokens\n", 0 == storage ? "TokenStream" : "list of words", store_best * 1000, store_best > 0 ? token_number / store_best / 1000000 : 0.0, walk_best * 1000, walk_best > 0 ? token_number * 2 / walk_best / 1000000 : 0.0, run_number, byte_per_token, token_number);
+	}
+	if (sum[0] != sum[1] || false == CompareTokens(&token_stream, &head))
+	{
+		head.RemoveAllNext();
+		printf("The tokens are different.\n");
+		return 1;
+	}
+	head.RemoveAllNext();
+	printf("The tokens are the same.\n");
+	return 0;
+}
+
+Word * Word::s_Insert(Word * it_next)
+{
+	if (NULL == it_next)
+	{
+		throw std::exception("Function \"Word * Word::s_Insert(Word * it_next)\" says: Invalid parameter \"it_next\".");
+	}
+	Word * new_node = new Word();
+	if (NULL == new_node)
+	{
+		return NULL;
+	}
+	// the new node
+	new_node->previous_ = it_next;
+	new_node->next_ = it_next->next_;
+	// next node of the new node: set previous
+	if (it_next->next_)
+	{
+		it_next->next_->previous_ = new_node;
+	}
+	// previous node of the new node: set next
+	it_next->next_ = new_node;
+	return new_node;
+}
+
+Word::Word()
+{
+	previous_ = NULL;
+	next_ = NULL;
+	content_ = NULL;
+	type_ = -1;
+	source_file_index_ = -1;
+}
+
+Word::~Word()
+{
+	if (content_ != NULL)
+	{
+		delete[] content_;
+		content_ = NULL;
+	}
+}
+
+void Word::RemoveAllNext()
+{
+	// in a loop, not recursively as in "word.h", for millions of words
+	Word * it = next_;
+	Word * it_next;
+	while (NULL != it)
+	{
+		it_next = it->next_;
+		delete it;
+		it = it_next;
+	}
+	next_ = NULL;
+}
+
+int64_t Word::SetContent(const char * content, int64_t length)
+{
+	// "content" is not terminated by '\0'.
+	if (NULL == content || length <= 0)
+	{
+		throw std::exception("Function \"int64_t Word::SetContent(const char * content, int64_t length)\" says: Invalid parameter \"content\".");
+	}
+	content_ = new char[length + 1];
+	if (NULL == content_)
+	{
+		return -1;
+	}
+	memcpy(content_, content, length);
+	content_[length] = '\0';
+	return 1;
+}
+
+void GenerateText(int64_t size, std::vector<char> * text_p)
+{
+	// statements in turn, as in "test/benchmark_lexer.cpp"
+	const char * statement_table[] =
+	{
+		"\ta = a + b * c - a / b % c;\n",
+		"\tb = ((a + b) * (c - a)) % 7;\n",
+		"\tc = a * -3 + -12 / b;\n",
+		"\tif (a < b)\n\t{\n\t\ta = a - 1;\n\t}\n\telse\n\t{\n\t\tb = b + 1;\n\t}\n",
+		"\twhile (c > a)\n\t{\n\t\tc = c - 2;\n\t}\n",
+		"\tresult_of_the_function = $ function_with_a_long_name(a, 1024) $;\n",
+		"\tinput $$ a $$;\n",
+		"\toutput $$ c $$;\n"
+	};
+	const char * statement;
+	text_p->clear();
+	for (int64_t i = 0; text_p->size() < size; ++i)
+	{
+		for (statement = statement_table[i % 8]; '\0' != *statement; ++statement)
+		{
+			text_p->push_back(*statement);
+		}
+	}
+}
+
+int64_t StoreInTokenStream(const char * text, int64_t size, TokenStream * token_stream_p)
+{
+	// the loop of function "LexicalAnalyse_Range", without child blocks and runs: Return the number of tokens, or -1 if there is an illegal character. The text should end with a blank, which ends the last token.
+	int64_t status = LexicalTable::c_state_start_;
+	int64_t beginning = 0;
+	int64_t index = 0;
+	int64_t length;
+	token_stream_p->SetText(text);
+	while (index < size)
+	{
+		if (LexicalTable::c_state_start_ == status)
+		{
+			beginning = index;
+		}
+		status = LexicalTable::s_transition_table_[status][LexicalTable::s_class_table_[(unsigned char)text[index]]];
+		if (status < LexicalTable::c_state_accept_)
+		{
+			index += 1;
+			continue;
+		}
+		if (LexicalTable::c_state_illegal_ == status)
+		{
+			return -1;
+		}
+		length = LexicalTable::s_fallback_table_[status] ? index - beginning : index - beginning + 1;
+		if (false == LexicalTable::s_fallback_table_[status])
+		{
+			index += 1;
+		}
+		if (false == (TokenStream::c_separator_ == LexicalTable::s_word_type_table_[status] && (' ' == text[beginning] || '\t' == text[beginning] || '\r' == text[beginning] || '\n' == text[beginning])))
+		{
+			token_stream_p->Append(LexicalTable::s_word_type_table_[status], beginning, beginning, length);
+		}
+		status = LexicalTable::c_state_start_;
+	}
+	return token_stream_p->size_;
+}
+
+int64_t StoreInList(const char * text, int64_t size, Word * head_p)
+{
+	// the same loop, but each token is a new node after the last one: Return the number of tokens, or -1 if there is an illegal character (or out of memory).
+	int64_t status = LexicalTable::c_state_start_;
+	int64_t beginning = 0;
+	int64_t index = 0;
+	int64_t length;
+	int64_t token_number = 0;
+	Word * it_last = head_p;
+	while (index < size)
+	{
+		if (LexicalTable::c_state_start_ == status)
+		{
+			beginning = index;
+		}
+		status = LexicalTable::s_transition_table_[status][LexicalTable::s_class_table_[(unsigned char)text[index]]];
+		if (status < LexicalTable::c_state_accept_)
+		{
+			index += 1;
+			continue;
+		}
+		if (LexicalTable::c_state_illegal_ == status)
+		{
+			return -1;
+		}
+		length = LexicalTable::s_fallback_table_[status] ? index - beginning : index - beginning + 1;
+		if (false == LexicalTable::s_fallback_table_[status])
+		{
+			index += 1;
+		}
+		if (false == (TokenStream::c_separator_ == LexicalTable::s_word_type_table_[status] && (' ' == text[beginning] || '\t' == text[beginning] || '\r' == text[beginning] || '\n' == text[beginning])))
+		{
+			it_last = Word::s_Insert(it_last);
+			if (NULL == it_last || -1 == it_last->SetContent(text + beginning, length))
+			{
+				return -1;
+			}
+			it_last->type_ = LexicalTable::s_word_type_table_[status];
+			it_last->source_file_index_ = beginning;
+			if (TokenStream::c_identifier_ == it_last->type_)
+			{
+				for (int64_t i = 0; i < 8; ++i)
+				{
+					if (0 == strcmp(it_last->content_, c_keyword_table[i]))
+					{
+						it_last->type_ = TokenStream::c_keyword_;
+						break;
+					}
+				}
+			}
+			token_number += 1;
+		}
+		status = LexicalTable::c_state_start_;
+	}
+	return token_number;
+}
+
+int64_t WalkTokenStream(const TokenStream * token_stream_p)
+{
+	int64_t sum = 0;
+	for (int64_t i = 0; i < token_stream_p->size_; ++i)
+	{
+		sum += token_stream_p->type_table_[i] * 256 + token_stream_p->text_[token_stream_p->text_table_[i]];
+	}
+	for (int64_t i = token_stream_p->size_ - 1; i >= 0; --i)
+	{
+		sum -= token_stream_p->type_table_[i] + token_stream_p->text_[token_stream_p->text_table_[i]];
+	}
+	return sum;
+}
+
+int64_t WalkList(const Word * head_p)
+{
+	int64_t sum = 0;
+	const Word * it_last = head_p;
+	for (const Word * it = head_p->next_; NULL != it; it = it->next_)
+	{
+		sum += it->type_ * 256 + it->content_[0];
+		it_last = it;
+	}
+	for (const Word * it = it_last; head_p != it; it = it->previous_)
+	{
+		sum -= it->type_ + it->content_[0];
+	}
+	return sum;
+}
+
+bool CompareTokens(const TokenStream * token_stream_p, const Word * head_p)
+{
+	// type, location and text of each token
+	const Word * it = head_p->next_;
+	for (int64_t i = 0; i < token_stream_p->size_; ++i, it = it->next_)
+	{
+		if (NULL == it || it->type_ != token_stream_p->type_table_[i] || it->source_file_index_ != token_stream_p->location_table_[i] || strlen(it->content_) != token_stream_p->length_table_[i] || 0 != memcmp(it->content_, token_stream_p->text_ + token_stream_p->text_table_[i], token_stream_p->length_table_[i]))
+		{
+			return false;
+		}
+	}
+	return NULL == it;
+}
@@ -0,0 +1,53 @@
+#!/bin/bash
+# Differential test of the engines of parsing blocks: Compile each source file in "test/engine" with "-e precedence" and with "-e pratt".
+# - A file accepted by both must give the same intermediate file, byte for byte.
+# - A file rejected by both must give the same error, with the same number and location.
+# usage: test/compare_engines.sh [compiler] [directory of source files]
+
+compiler=${1:-./C-like-compiler}
+source_directory=${2:-$(dirname "$0")/engine}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+file_number=0
+fail_number=0
+for source in "$source_directory"/*.c
+do
+	name=$(basename "$source" .c)
+	for engine in precedence pratt
+	do
+		"$compiler" -e $engine "$source" "$work_directory/$name.$engine.i" > "$work_directory/$name.$engine.out" 2> /dev/null
+	done
+	file_number=$((file_number + 1))
+	if [ -f "$work_directory/$name.precedence.i" ] && [ -f "$work_directory/$name.pratt.i" ]
+	then
+		if cmp -s "$work_directory/$name.precedence.i" "$work_directory/$name.pratt.i"
+		then
+			echo "same      $name"
+		else
+			echo "DIFFERENT $name: The intermediate files are different."
+			fail_number=$((fail_number + 1))
+		fi
+	elif [ ! -f "$work_directory/$name.precedence.i" ] && [ ! -f "$work_directory/$name.pratt.i" ]
+	then
+		precedence_error=$(grep '^\[0x' "$work_directory/$name.precedence.out")
+		pratt_error=$(grep '^\[0x' "$work_directory/$name.pratt.out")
+		if [ -n "$precedence_error" ] && [ "$precedence_error" = "$pratt_error" ]
+		then
+			echo "same      $name (error ${precedence_error%% *})"
+		else
+			echo "DIFFERENT $name: error \"$precedence_error\" (precedence) and \"$pratt_error\" (pratt)"
+			fail_number=$((fail_number + 1))
+		fi
+	else
+		echo "DIFFERENT $name: Only one engine accepts it."
+		fail_number=$((fail_number + 1))
+	fi
+done
+echo
+echo "$((file_number - fail_number)) of $file_number files are the same."
+[ 0 -eq $fail_number ]
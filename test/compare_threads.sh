@@ -0,0 +1,101 @@
+#!/bin/bash
+# Differential test of the threads: Generate a large source file (of more than 2 chunks of 1 MB, so it is preprocessed in parallel), compile it with "-j 1" and with "-j [number of threads]", and compare.
+# - The right source file must give the same intermediate file, byte for byte.
+# - Wrong copies of it (a syntax error in the last function, and a "}" too many) must give the same error, with the same number and location.
+# Lines end with "\n" or "\r\n" in turn, and annotations (with braces in them) are in one line or across lines, so the slices of preprocessing begin anywhere.
+# usage: test/compare_threads.sh [compiler] [number of threads] [number of functions]
+
+compiler=${1:-./C-like-compiler}
+thread_number=${2:-4}
+function_number=${3:-4000}
+if [ ! -x "$compiler" ]
+then
+	echo "The compiler \"$compiler\" is not found."
+	exit 2
+fi
+work_directory=$(mktemp -d)
+trap 'rm -rf "$work_directory"' EXIT
+for name in right syntax brace
+do
+	awk -v function_number=$function_number -v name=$name 'BEGIN {
+		for (f = 0; f < function_number; ++f)
+		{
+			lf = (0 == f % 3) ? "\r\n" : "\n"
+			printf "/* function %d { } */%s", f, lf
+			if (f == function_number - 1)
+			{
+				printf "void main()%s", lf
+			}
+			else
+			{
+				printf "int f%d(int p, int q)%s", f, lf
+			}
+			printf "{%s", lf
+			printf "\tint a; /* { a */%s", lf
+			printf "\tint b;%s", lf
+			for (s = 0; s < 24; ++s)
+			{
+				k = s % 6
+				if (0 == k) printf "\ta = a + b * 3;%s", lf
+				else if (1 == k) printf "\t/* one line,%s\t { another } line */%s", lf, lf
+				else if (2 == k) printf "\tif (a < b)%s\t{%s\t\twhile (b > 0)%s\t\t{%s\t\t\tb = b - 1; /* } */%s\t\t}%s\t}%s", lf, lf, lf, lf, lf, lf, lf
+				else if (3 == k) printf "\tb = (a - 1) / 2; /**/ /***/%s", lf
+				else if (4 == k && f > 0) printf "\ta = $ f%d(a, b) $;%s", f - 1, lf
+				else printf "\toutput $$ a $$;%s", lf
+			}
+			if (f == function_number - 1 && "syntax" == name)
+			{
+				printf "\ta = ;%s", lf
+			}
+			if (f < function_number - 1)
+			{
+				printf "\treturn p;%s", lf
+			}
+			printf "}%s", lf
+		}
+		if ("brace" == name)
+		{
+			printf "}\n"
+		}
+	}' > "$work_directory/$name.c"
+done
+echo "source file: $function_number functions, $(wc -c < "$work_directory/right.c") bytes"
+fail_number=0
+for name in right syntax brace
+do
+	for j in 1 $thread_number
+	do
+		"$compiler" -j $j "$work_directory/$name.c" "$work_directory/$name.$j.i" > "$work_directory/$name.$j.out" 2> /dev/null
+	done
+	if [ -f "$work_directory/$name.1.i" ] && [ -f "$work_directory/$name.$thread_number.i" ]
+	then
+		if cmp -s "$work_directory/$name.1.i" "$work_directory/$name.$thread_number.i"
+		then
+			echo "same      $name"
+		else
+			echo "DIFFERENT $name: The intermediate files are different."
+			fail_number=$((fail_number + 1))
+		fi
+	elif [ ! -f "$work_directory/$name.1.i" ] && [ ! -f "$work_directory/$name.$thread_number.i" ]
+	then
+		error_1=$(grep '^\[0x' "$work_directory/$name.1.out")
+		error_n=$(grep '^\[0x' "$work_directory/$name.$thread_number.out")
+		if [ -n "$error_1" ] && [ "$error_1" = "$error_n" ]
+		then
+			echo "same      $name (error $error_1)"
+		else
+			echo "DIFFERENT $name: error \"$error_1\" (1 thread) and \"$error_n\" ($thread_number threads)"
+			fail_number=$((fail_number + 1))
+		fi
+	else
+		echo "DIFFERENT $name: Only one of them accepts it."
+		fail_number=$((fail_number + 1))
+	fi
+done
+if [ ! -f "$work_directory/right.1.i" ]
+then
+	echo "The right source file is not accepted:"
+	grep '^\[0x' "$work_directory/right.1.out"
+	fail_number=$((fail_number + 1))
+fi
+[ 0 -eq $fail_number ]
@@ -0,0 +1,48 @@
+/* calls with and without parameters, and calls in conditional blocks */
+int zero()
+{
+	int z;
+	z = 0;
+	return z;
+}
+
+int add(int a, int b)
+{
+	int t;
+	t = a + b;
+	return t;
+}
+
+int mix(int a, int b)
+{
+	int s;
+	int t;
+	s = $ add(a, b) $;
+	t = $ add(b, a) $;
+	s = s * t;
+	t = $ zero() $;
+	s = s - t;
+	return s;
+}
+
+int show(int v)
+{
+	int w;
+	w = v;
+	output $$ w $$;
+	return v;
+}
+
+void main()
+{
+	int x;
+	int y;
+	input $$ x $$;
+	y = $ mix(x, 4) $;
+	y = $ show(y) $;
+	y = $ add(x, 7) $;
+	if (x < y)
+	{
+		x = $ show(x) $;
+	}
+}
@@ -0,0 +1,10 @@
+int f(int a, int b)
+{
+	return a;
+}
+
+void main()
+{
+	int a;
+	a = $ f(a + 1, a * 2) $;
+}
@@ -0,0 +1,7 @@
+void main()
+{
+	int a;
+	{
+		a = 1;
+	}
+}
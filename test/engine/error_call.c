@@ -0,0 +1,11 @@
+int add(int p, int q)
+{
+	return p;
+}
+
+void main()
+{
+	int a;
+	int b;
+	a = $ adda, b) $;
+}
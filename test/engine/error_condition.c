@@ -0,0 +1,8 @@
+void main()
+{
+	int a;
+	int b;
+	if (a + 1 < b)
+	{
+	}
+}
@@ -0,0 +1,6 @@
+void main()
+{
+	int a;
+	it
+	a;
+}
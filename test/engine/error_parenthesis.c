@@ -0,0 +1,5 @@
+void main()
+{
+	int a;
+	a = (a + 1;
+}
@@ -0,0 +1,37 @@
+/* precedence, associativity, parentheses and negative constants */
+void main()
+{
+	int a;
+	int b;
+	int c;
+	int d;
+
+	input $$ a $$;
+	input $$ b $$;
+
+	c = a + b * c - a / b % c;
+	d = a - b - c - 1;
+	d = a / b / c;
+	d = a * b % c * d;
+	d = (a + b) * (c - d);
+	d = ((a + b) * (c - a)) % 7;
+	d = ((a + (b * (c - (d / 2)))) % 7);
+	d = a * -3 + -12 / b;
+	d = -3 * -4 - -5;
+	d = (((((a)))));
+	c = a + b + c + d * a * b * c % d;
+
+	if (a < b)
+	{
+		output $$ a $$;
+	}
+	if (!a)
+	{
+		output $$ b $$;
+	}
+	while (c == d)
+	{
+		c = c - -3;
+	}
+	output $$ d $$;
+}
@@ -0,0 +1,317 @@
+
+int f0()
+{
+	int v0_0;
+	v0_0 = v0_0 + 7;
+	/* * / { */
+	v0_0 = v0_0 * 0;
+	int v0_1;
+	int v0_2;
+	int v0_3;
+	if (v0_3 == v0_0)
+{
+v0_1 = v0_3 % 12;
+	if (v0_3 > v0_0)
+{
+input $$ v0_0 $$;
+	/**/
+	int v2_0;
+	while (v2_0 > v2_0) {
+v0_3 = v2_0 % 0;
+}
+	/* multi
+ line { } comment */
+}
+	if (v0_2 == v0_2)
+{
+
+}
+else
+{
+
+}
+	v0_3 = 100;
+}
+else
+{
+
+}
+	input $$ v0_3 $$;
+	v0_1 = v0_1 - v0_0;
+	v0_0 = v0_2 * 12;
+	input $$ v0_1 $$;
+	if (v0_3 < v0_3)
+{
+if (v0_1 == v0_3)
+{
+input $$ v0_3 $$;
+	v0_2 = 0;
+	input $$ v0_1 $$;
+}
+else
+{
+
+}
+	while (v0_2 < v0_0) {
+
+}
+}
+else
+{
+v0_2 = v0_0 * v0_2;
+	/* multi
+ line { } comment */
+	v0_3 = v0_1 * 7;
+}
+	int v0_4;
+	v0_2 = v0_1 + v0_4;
+	v0_1 = 0;
+	int v0_5;
+	/* multi
+ line { } comment */
+	int v0_6;
+	v0_4 = v0_4 / 12;
+	v0_5 = v0_6;
+	v0_4 = 5;
+}
+
+/* * / { */
+void f1(int p0)
+{
+	int v0_0;
+	/* multi
+ line { } comment */
+	output $$ v0_0 $$;
+	/* c */
+	v0_0 = v0_0 - 12;
+	int v0_1;
+	input $$ v0_0 $$;
+	v0_0 = $ f0() $;
+	v0_0 = p0 / -3;
+	output $$ v0_1 $$;
+	/* * / { */
+	int v0_2;
+	v0_0 = v0_1 - p0;
+	input $$ v0_2 $$;
+	v0_1 = v0_0 + 7;
+	v0_2 = v0_2 + v0_2;
+	/* multi
+ line { } comment */
+	v0_2 = v0_0 * 7;
+	v0_1 = v0_1 + -3;
+	/* * / { */
+	int v0_3;
+	int v0_4;
+	/* c */
+	v0_0 = v0_0 * v0_1;
+	while (v0_2 < v0_3) {
+v0_2 = p0 * v0_3;
+	output $$ v0_3 $$;
+	int v1_0;
+	/**/
+	int v1_1;
+}
+	/* c */
+	input $$ v0_0 $$;
+	/* * / { */
+}
+
+
+int f2()
+{
+	int v0_0;
+	v0_0 = v0_0 * 12;
+	v0_0 = v0_0 + -3;
+	/**/
+	while (v0_0 > v0_0) {
+v0_0 = v0_0 % -3;
+	/* multi
+ line { } comment */
+	while (v0_0 == v0_0) {
+v0_0 = v0_0 - -3;
+	input $$ v0_0 $$;
+}
+}
+	if (v0_0 > v0_0)
+{
+
+}
+else
+{
+while (v0_0 < v0_0) {
+
+}
+	v0_0 = $ f0() $;
+	/* multi
+ line { } comment */
+}
+	v0_0 = v0_0 + v0_0;
+	/**/
+	v0_0 = 5;
+	while (v0_0 == v0_0) {
+while (v0_0 > v0_0) {
+
+}
+}
+	v0_0 = $ f0() $;
+	/* c */
+	while (v0_0 < v0_0) {
+v0_0 = -11;
+	/* c */
+	if (v0_0 > v0_0)
+{
+v0_0 = v0_0 / v0_0;
+	/* * / { */
+	int v2_0;
+	v0_0 = v0_0 * v0_0;
+	int v2_1;
+}
+else
+{
+v0_0 = v0_0 / 7;
+	/**/
+	v0_0 = -11;
+	/* * / { */
+	if (v0_0 == v0_0)
+{
+v0_0 = $ f1(v0_0) $;
+	while (v0_0 < v0_0) {
+v0_0 = v0_0 * 12;
+	input $$ v0_0 $$;
+}
+}
+}
+	/**/
+	v0_0 = v0_0 / 0;
+}
+	v0_0 = 5;
+	if (v0_0 == v0_0)
+{
+v0_0 = v0_0;
+}
+else
+{
+output $$ v0_0 $$;
+	output $$ v0_0 $$;
+	/* * / { */
+	v0_0 = v0_0;
+}
+	int v0_1;
+	/* multi
+ line { } comment */
+	v0_1 = v0_0 % v0_1;
+	int v0_2;
+	v0_1 = v0_1 - v0_1;
+	/* multi
+ line { } comment */
+	v0_2 = v0_2 * 12;
+	input $$ v0_0 $$;
+	v0_0 = -11;
+	v0_0 = v0_1 + 12;
+	/* c */
+}
+
+/* multi
+ line { } comment */
+int f3(int p0, int p1)
+{
+	int v0_0;
+	input $$ v0_0 $$;
+	v0_0 = v0_0 + v0_0;
+	v0_0 = p1 / -3;
+	if (p1 < v0_0)
+{
+v0_0 = v0_0 * p0;
+	v0_0 = 100;
+	v0_0 = v0_0 - -3;
+}
+	v0_0 = v0_0;
+	while (v0_0 < p1) {
+if (v0_0 > v0_0)
+{
+
+}
+else
+{
+if (p1 > p0)
+{
+
+}
+}
+}
+	/* * / { */
+	output $$ v0_0 $$;
+	/**/
+	v0_0 = 5;
+	/* c */
+	while (p1 < p1) {
+
+}
+	int v0_1;
+	v0_0 = v0_1;
+	v0_0 = v0_0 % v0_1;
+	/**/
+	v0_0 = p0 / -3;
+	/**/
+	v0_1 = p1 % 0;
+	/**/
+	input $$ v0_1 $$;
+	v0_1 = p1 % p0;
+	v0_0 = p1 - 7;
+	v0_1 = v0_1 % v0_0;
+	v0_1 = p1 * 12;
+	return p0;
+}
+
+/**/
+void main(int p0, int p1)
+{
+	int v0_0;
+	/**/
+	v0_0 = -11;
+	/* c */
+	output $$ v0_0 $$;
+	v0_0 = 100;
+	v0_0 = v0_0 - 0;
+	/* multi
+ line { } comment */
+	v0_0 = -11;
+	v0_0 = p1 % 7;
+	/**/
+	v0_0 = v0_0 - p0;
+	/* c */
+	input $$ v0_0 $$;
+	input $$ v0_0 $$;
+	v0_0 = v0_0 + p1;
+	output $$ v0_0 $$;
+	v0_0 = p0 * 7;
+	/* c */
+	v0_0 = 5;
+	while (p1 < p0) {
+
+}
+	int v0_1;
+	/* multi
+ line { } comment */
+	if (v0_1 > v0_0)
+{
+if (p1 < p0)
+{
+output $$ v0_0 $$;
+	v0_1 = $ f0() $;
+	v0_1 = 5;
+	while (p0 > p1) {
+
+}
+	/* multi
+ line { } comment */
+}
+	int v1_0;
+	/* * / { */
+}
+	/**/
+	int v0_2;
+	v0_0 = p1 / -3;
+	v0_1 = v0_0 + 7;
+	/* * / { */
+}
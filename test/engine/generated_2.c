@@ -0,0 +1,356 @@
+
+int f0()
+{
+	int v0_0;
+	while (v0_0 > v0_0) {
+int v1_0;
+	v1_0 = v1_0;
+	v1_0 = v1_0 + v0_0;
+	v0_0 = v1_0 % -3;
+}
+	/* c */
+	v0_0 = v0_0 % 7;
+	if (v0_0 > v0_0)
+{
+output $$ v0_0 $$;
+	v0_0 = v0_0 / 7;
+	v0_0 = v0_0 % 0;
+	v0_0 = 100;
+}
+	v0_0 = 100;
+	input $$ v0_0 $$;
+	v0_0 = 0;
+	v0_0 = v0_0 + 12;
+	output $$ v0_0 $$;
+	int v0_1;
+	int v0_2;
+	if (v0_0 == v0_0)
+{
+v0_2 = v0_0 / v0_0;
+	int v1_0;
+}
+else
+{
+
+}
+	/* c */
+	int v0_3;
+	int v0_4;
+	/* multi
+ line { } comment */
+	while (v0_4 == v0_0) {
+if (v0_1 < v0_0)
+{
+
+}
+else
+{
+
+}
+	/* * / { */
+	int v1_0;
+	while (v1_0 < v0_2) {
+input $$ v1_0 $$;
+	/* multi
+ line { } comment */
+	int v2_0;
+	input $$ v0_0 $$;
+}
+}
+	/* * / { */
+	v0_2 = -11;
+	v0_4 = v0_2 + -3;
+	if (v0_2 < v0_1)
+{
+v0_0 = v0_3 % v0_3;
+}
+else
+{
+int v1_0;
+	/* multi
+ line { } comment */
+	if (v0_4 == v0_2)
+{
+if (v0_2 == v0_0)
+{
+int v3_0;
+}
+else
+{
+
+}
+	/* c */
+	int v2_0;
+}
+else
+{
+
+}
+	v0_2 = 0;
+	/* multi
+ line { } comment */
+}
+	v0_4 = v0_4 % v0_0;
+	/* * / { */
+	output $$ v0_4 $$;
+	/* c */
+}
+
+/* c */
+void f1(int p0)
+{
+	int v0_0;
+	int v0_1;
+	if (v0_0 > p0)
+{
+int v1_0;
+	input $$ v1_0 $$;
+	input $$ v0_0 $$;
+}
+else
+{
+output $$ v0_0 $$;
+	/* c */
+}
+	output $$ v0_0 $$;
+	/* * / { */
+	v0_1 = v0_1 / v0_1;
+	/**/
+	v0_0 = p0 + v0_1;
+	/**/
+	if (p0 == p0)
+{
+
+}
+	int v0_2;
+	v0_1 = v0_2 * v0_1;
+	input $$ v0_2 $$;
+	input $$ v0_1 $$;
+	v0_2 = v0_0 / v0_1;
+	/* * / { */
+	if (p0 == p0)
+{
+
+}
+else
+{
+input $$ v0_0 $$;
+}
+	if (p0 < v0_1)
+{
+v0_2 = v0_1 - 12;
+	/* multi
+ line { } comment */
+	v0_1 = 5;
+	v0_1 = v0_1 - v0_1;
+}
+else
+{
+while (v0_0 > v0_2) {
+
+}
+	v0_0 = v0_0 % 0;
+}
+	if (v0_2 == v0_2)
+{
+v0_1 = p0;
+	input $$ v0_0 $$;
+}
+else
+{
+v0_2 = p0;
+	v0_1 = -11;
+	int v1_0;
+}
+	v0_0 = $ f0() $;
+	v0_1 = $ f0() $;
+	v0_1 = $ f0() $;
+	int v0_3;
+	v0_1 = v0_1 % 12;
+}
+
+
+int f2(int p0)
+{
+	int v0_0;
+	if (p0 == v0_0)
+{
+v0_0 = 5;
+	v0_0 = $ f1(p0) $;
+	/* multi
+ line { } comment */
+}
+else
+{
+v0_0 = v0_0 * 12;
+	/* * / { */
+	v0_0 = p0;
+	v0_0 = v0_0 * v0_0;
+}
+	v0_0 = 5;
+	/**/
+	v0_0 = v0_0 / 12;
+	v0_0 = p0 + 0;
+	/* * / { */
+	v0_0 = $ f1(p0) $;
+	/* * / { */
+	input $$ v0_0 $$;
+	int v0_1;
+	v0_1 = v0_0 * 12;
+	output $$ v0_1 $$;
+	v0_0 = v0_0 - v0_1;
+	v0_1 = -11;
+	while (p0 > v0_1) {
+v0_1 = v0_1 * v0_1;
+	while (v0_1 == v0_1) {
+v0_0 = 100;
+	v0_1 = 100;
+}
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 + v0_0;
+}
+	output $$ v0_1 $$;
+	/**/
+	v0_1 = v0_1 % 7;
+	output $$ v0_1 $$;
+	output $$ v0_0 $$;
+	while (v0_0 > p0) {
+v0_0 = p0 - v0_1;
+	while (p0 > v0_0) {
+int v2_0;
+	/* c */
+	v2_0 = v0_1 * v0_1;
+	int v2_1;
+	if (v2_0 < p0)
+{
+while (v2_0 == v0_1) {
+input $$ v0_0 $$;
+	v2_1 = 0;
+	v2_1 = 0;
+	int v4_0;
+	/* multi
+ line { } comment */
+}
+	/* multi
+ line { } comment */
+	int v3_0;
+	while (p0 > p0) {
+v0_0 = p0 / v0_1;
+	input $$ v2_1 $$;
+	/* * / { */
+}
+	/* * / { */
+}
+else
+{
+
+}
+	/* c */
+}
+	/* c */
+	input $$ v0_1 $$;
+}
+	int v0_2;
+	int v0_3;
+	/* c */
+	return p0;
+}
+
+
+int f3()
+{
+	int v0_0;
+	if (v0_0 == v0_0)
+{
+int v1_0;
+	if (v0_0 < v1_0)
+{
+v0_0 = v1_0 / v1_0;
+}
+	v1_0 = $ f1(v1_0) $;
+	v1_0 = -11;
+}
+else
+{
+
+}
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 + 12;
+	while (v0_0 == v0_0) {
+input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+}
+	int v0_1;
+	output $$ v0_0 $$;
+	output $$ v0_1 $$;
+	v0_0 = v0_1;
+	v0_0 = v0_0 / -3;
+	if (v0_0 == v0_1)
+{
+
+}
+else
+{
+v0_0 = v0_1 % 0;
+	int v1_0;
+	/* * / { */
+}
+	v0_1 = v0_1;
+	v0_1 = $ f2(v0_1) $;
+	/* * / { */
+	input $$ v0_1 $$;
+	v0_0 = v0_1 % v0_1;
+	v0_0 = v0_0 * 0;
+	/* c */
+	v0_1 = v0_1 * v0_0;
+	if (v0_1 < v0_1)
+{
+input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 / 0;
+	v0_1 = v0_1 + 12;
+}
+	/**/
+	input $$ v0_0 $$;
+	/**/
+	v0_1 = $ f2(v0_1) $;
+	/* multi
+ line { } comment */
+	v0_0 = $ f1(4) $;
+	/* * / { */
+}
+
+
+void main()
+{
+	int v0_0;
+	v0_0 = v0_0 - 7;
+	input $$ v0_0 $$;
+	v0_0 = 5;
+	v0_0 = v0_0 * 12;
+	v0_0 = v0_0 + 12;
+	v0_0 = v0_0 / v0_0;
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 + 12;
+	v0_0 = v0_0;
+	int v0_1;
+	int v0_2;
+	v0_1 = v0_0 * -3;
+	int v0_3;
+	v0_2 = $ f2(v0_2) $;
+	output $$ v0_1 $$;
+	/**/
+	v0_0 = v0_0 % -3;
+	int v0_4;
+	v0_3 = $ f3() $;
+	while (v0_1 == v0_0) {
+
+}
+	v0_2 = v0_1;
+	/* c */
+}
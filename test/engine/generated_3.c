@@ -0,0 +1,366 @@
+
+int f0()
+{
+	int v0_0;
+	if (v0_0 == v0_0)
+{
+v0_0 = v0_0 / 7;
+	input $$ v0_0 $$;
+	input $$ v0_0 $$;
+}
+	/* c */
+	v0_0 = v0_0 / -3;
+	output $$ v0_0 $$;
+	if (v0_0 > v0_0)
+{
+
+}
+else
+{
+v0_0 = v0_0 / -3;
+}
+	v0_0 = v0_0 + -3;
+	if (v0_0 == v0_0)
+{
+output $$ v0_0 $$;
+	v0_0 = v0_0 + -3;
+	if (v0_0 < v0_0)
+{
+
+}
+else
+{
+int v2_0;
+}
+	int v1_0;
+}
+	if (v0_0 == v0_0)
+{
+
+}
+else
+{
+
+}
+	/* c */
+	v0_0 = v0_0;
+	v0_0 = v0_0 * -3;
+	output $$ v0_0 $$;
+	input $$ v0_0 $$;
+	if (v0_0 == v0_0)
+{
+if (v0_0 > v0_0)
+{
+v0_0 = 5;
+	v0_0 = v0_0;
+}
+	/**/
+	v0_0 = 100;
+	int v1_0;
+	/* c */
+}
+	/* * / { */
+	v0_0 = v0_0 * 7;
+	v0_0 = v0_0 / -3;
+	int v0_1;
+	while (v0_1 == v0_0) {
+v0_0 = v0_0 / 12;
+	/**/
+	v0_0 = v0_1;
+}
+	int v0_2;
+	v0_0 = v0_2 * 7;
+	int v0_3;
+}
+
+
+int f1(int p0, int p1)
+{
+	int v0_0;
+	input $$ v0_0 $$;
+	v0_0 = p0 * 7;
+	if (p1 > v0_0)
+{
+int v1_0;
+	v0_0 = v1_0 % 0;
+	/* * / { */
+	input $$ v1_0 $$;
+}
+	input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	int v0_1;
+	if (p1 > p0)
+{
+
+}
+else
+{
+
+}
+	/**/
+	v0_0 = p0 + 0;
+	v0_0 = v0_1 * p0;
+	/* c */
+	v0_1 = v0_0 + v0_0;
+	input $$ v0_0 $$;
+	v0_1 = v0_1 / p0;
+	int v0_2;
+	/* multi
+ line { } comment */
+	int v0_3;
+	/* * / { */
+	v0_0 = v0_2;
+	v0_3 = v0_0 * p1;
+	v0_2 = $ f0() $;
+	/**/
+	v0_3 = p1 + 0;
+	v0_2 = $ f0() $;
+	if (v0_2 > v0_3)
+{
+
+}
+	return p0;
+}
+
+
+void f2(int p0)
+{
+	int v0_0;
+	v0_0 = -11;
+	if (p0 > p0)
+{
+int v1_0;
+	/**/
+	v0_0 = v1_0 * 12;
+	int v1_1;
+}
+	while (p0 == v0_0) {
+v0_0 = 0;
+	/* * / { */
+	int v1_0;
+	/* c */
+	if (v0_0 < p0)
+{
+input $$ v0_0 $$;
+	/* c */
+	if (v1_0 > v1_0)
+{
+while (p0 == v1_0) {
+input $$ v0_0 $$;
+	int v4_0;
+	v0_0 = $ f0() $;
+	/* multi
+ line { } comment */
+	input $$ v1_0 $$;
+}
+	v1_0 = v0_0 / -3;
+}
+}
+else
+{
+input $$ v0_0 $$;
+	v0_0 = $ f1(v0_0, 4) $;
+	/* * / { */
+	while (v1_0 == v0_0) {
+if (p0 < v0_0)
+{
+int v4_0;
+}
+	v1_0 = 0;
+	v0_0 = $ f1(v0_0, v1_0) $;
+	/* * / { */
+	v1_0 = v1_0 - v1_0;
+}
+}
+	if (v1_0 == p0)
+{
+v1_0 = $ f0() $;
+	int v2_0;
+	while (p0 > v0_0) {
+if (p0 < v1_0)
+{
+output $$ v1_0 $$;
+	/* c */
+}
+	/* c */
+}
+}
+else
+{
+
+}
+	/**/
+}
+	v0_0 = v0_0 % -3;
+	/**/
+	v0_0 = v0_0 + -3;
+	while (v0_0 > p0) {
+v0_0 = v0_0 / p0;
+	v0_0 = 5;
+	if (v0_0 > v0_0)
+{
+int v2_0;
+	v0_0 = v2_0 % -3;
+}
+	/**/
+	if (p0 == p0)
+{
+v0_0 = v0_0 + p0;
+}
+}
+	v0_0 = p0 / -3;
+	if (p0 == p0)
+{
+v0_0 = 100;
+	/**/
+	v0_0 = p0 / p0;
+	/**/
+	output $$ v0_0 $$;
+	input $$ v0_0 $$;
+}
+	/**/
+	v0_0 = $ f0() $;
+	/* multi
+ line { } comment */
+	v0_0 = $ f1(4, p0) $;
+	while (p0 == p0) {
+input $$ v0_0 $$;
+}
+	/* * / { */
+	output $$ v0_0 $$;
+	output $$ v0_0 $$;
+	v0_0 = v0_0;
+	/* multi
+ line { } comment */
+	while (p0 < p0) {
+v0_0 = v0_0 - v0_0;
+	/* * / { */
+	int v1_0;
+	/* multi
+ line { } comment */
+	int v1_1;
+}
+	int v0_1;
+	v0_0 = p0 % 7;
+	v0_0 = v0_0 - 0;
+	v0_0 = $ f0() $;
+}
+
+/**/
+int f3()
+{
+	int v0_0;
+	while (v0_0 > v0_0) {
+
+}
+	input $$ v0_0 $$;
+	v0_0 = 0;
+	/* * / { */
+	v0_0 = v0_0 / 0;
+	/* c */
+	if (v0_0 > v0_0)
+{
+v0_0 = v0_0 + 7;
+	/**/
+	int v1_0;
+	v1_0 = v0_0 - v0_0;
+	if (v0_0 < v0_0)
+{
+v0_0 = 5;
+	v0_0 = v0_0 + 12;
+	v0_0 = v0_0 - v1_0;
+}
+else
+{
+if (v1_0 < v0_0)
+{
+v0_0 = v1_0 / 7;
+	int v3_0;
+}
+	int v2_0;
+}
+	/* c */
+}
+else
+{
+
+}
+	/* c */
+	v0_0 = 100;
+	/* * / { */
+	v0_0 = v0_0 + -3;
+	v0_0 = $ f1(v0_0, 4) $;
+	int v0_1;
+	v0_1 = v0_1 / v0_1;
+	v0_1 = v0_1 - -3;
+	v0_1 = -11;
+	while (v0_1 > v0_0) {
+v0_0 = v0_0 + -3;
+}
+	input $$ v0_0 $$;
+	output $$ v0_1 $$;
+	input $$ v0_1 $$;
+	int v0_2;
+	/* c */
+	v0_0 = v0_1 / v0_0;
+	v0_2 = v0_2 - v0_0;
+	/* c */
+}
+
+
+int main()
+{
+	int v0_0;
+	v0_0 = -11;
+	if (v0_0 < v0_0)
+{
+
+}
+else
+{
+int v1_0;
+	v1_0 = v0_0 / 12;
+}
+	while (v0_0 == v0_0) {
+v0_0 = v0_0 * 0;
+	v0_0 = v0_0 * 12;
+	int v1_0;
+}
+	/* c */
+	v0_0 = v0_0 + 0;
+	/* multi
+ line { } comment */
+	while (v0_0 == v0_0) {
+v0_0 = 100;
+	output $$ v0_0 $$;
+	while (v0_0 > v0_0) {
+v0_0 = v0_0;
+	int v2_0;
+	/* c */
+}
+	int v1_0;
+}
+	/* * / { */
+	int v0_1;
+	v0_1 = v0_1 + v0_1;
+	/* * / { */
+	v0_1 = v0_0 / v0_1;
+	v0_1 = v0_0;
+	v0_1 = v0_0;
+	input $$ v0_1 $$;
+	/**/
+	output $$ v0_1 $$;
+	output $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	v0_0 = 5;
+	/* * / { */
+	v0_1 = v0_1 + 0;
+	/* c */
+	v0_0 = v0_1 % v0_0;
+	v0_1 = v0_1 * -3;
+	/* * / { */
+	int v0_2;
+	v0_2 = v0_2 - v0_1;
+}
@@ -0,0 +1,358 @@
+
+void f0()
+{
+	int v0_0;
+	v0_0 = v0_0 / v0_0;
+	while (v0_0 == v0_0) {
+while (v0_0 > v0_0) {
+
+}
+	input $$ v0_0 $$;
+	/**/
+}
+	/**/
+	int v0_1;
+	if (v0_0 < v0_0)
+{
+v0_1 = v0_1 * v0_0;
+	v0_1 = 0;
+	v0_1 = v0_0 * v0_1;
+}
+else
+{
+
+}
+	v0_1 = v0_1;
+	/* multi
+ line { } comment */
+	int v0_2;
+	if (v0_1 > v0_0)
+{
+v0_0 = v0_2 % v0_2;
+	int v1_0;
+	/* multi
+ line { } comment */
+}
+else
+{
+int v1_0;
+}
+	/* c */
+	int v0_3;
+	output $$ v0_2 $$;
+	v0_0 = v0_2;
+	/* multi
+ line { } comment */
+	while (v0_3 == v0_0) {
+if (v0_3 > v0_1)
+{
+v0_0 = v0_1 % -3;
+	v0_2 = 100;
+}
+	v0_0 = v0_1 + v0_1;
+	/* multi
+ line { } comment */
+}
+	v0_0 = v0_3;
+	v0_2 = v0_0 % v0_1;
+	v0_1 = v0_1 - 12;
+	v0_1 = 0;
+	if (v0_3 < v0_3)
+{
+int v1_0;
+	/* multi
+ line { } comment */
+}
+	v0_0 = v0_2 * v0_2;
+	v0_3 = v0_0 + 0;
+	v0_3 = v0_1 * -3;
+}
+
+
+int f1(int p0)
+{
+	int v0_0;
+	v0_0 = v0_0 + -3;
+	if (p0 > p0)
+{
+if (p0 < v0_0)
+{
+v0_0 = 0;
+	/* c */
+	v0_0 = p0 % p0;
+	/* * / { */
+	output $$ v0_0 $$;
+	v0_0 = v0_0 / 0;
+	/* c */
+}
+	/**/
+	v0_0 = $ f0() $;
+}
+	int v0_1;
+	input $$ v0_0 $$;
+	v0_0 = 100;
+	while (v0_0 < p0) {
+
+}
+	while (v0_0 == v0_0) {
+input $$ v0_1 $$;
+	/* multi
+ line { } comment */
+	if (v0_0 > p0)
+{
+v0_1 = p0 - v0_0;
+	v0_0 = v0_1 - p0;
+	int v2_0;
+	/* * / { */
+	v2_0 = -11;
+}
+else
+{
+while (v0_1 < v0_1) {
+
+}
+}
+	output $$ v0_1 $$;
+}
+	output $$ v0_1 $$;
+	v0_1 = p0 % v0_1;
+	v0_0 = v0_0 % p0;
+	if (v0_0 > p0)
+{
+while (v0_1 == p0) {
+
+}
+	output $$ v0_0 $$;
+	v0_0 = p0 + v0_1;
+	while (p0 > p0) {
+v0_0 = v0_0 % 0;
+}
+}
+else
+{
+if (v0_1 < v0_1)
+{
+input $$ v0_1 $$;
+	v0_1 = v0_0 - 0;
+}
+	v0_1 = 0;
+	v0_1 = v0_0;
+}
+	v0_1 = v0_1 % 7;
+	v0_0 = p0 % v0_0;
+	v0_1 = v0_1;
+	output $$ v0_1 $$;
+	if (v0_0 == p0)
+{
+output $$ v0_0 $$;
+	/* c */
+}
+else
+{
+int v1_0;
+	/* c */
+	v0_1 = v0_1 + v0_0;
+	/**/
+}
+	if (p0 == p0)
+{
+v0_0 = v0_1;
+	int v1_0;
+	v0_1 = v1_0 - v0_1;
+}
+else
+{
+v0_1 = v0_0 / -3;
+}
+	v0_0 = v0_0 * p0;
+	while (p0 < p0) {
+input $$ v0_0 $$;
+	/* c */
+	v0_0 = 0;
+	if (v0_1 == v0_0)
+{
+input $$ v0_0 $$;
+	/**/
+	v0_0 = v0_1 / 12;
+}
+else
+{
+while (v0_0 == v0_0) {
+
+}
+	output $$ v0_0 $$;
+}
+	v0_1 = $ f0() $;
+}
+	/* c */
+	return p0;
+}
+
+/* multi
+ line { } comment */
+int f2(int p0, int p1)
+{
+	int v0_0;
+	v0_0 = v0_0 * p1;
+	output $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	if (v0_0 < v0_0)
+{
+
+}
+else
+{
+v0_0 = p0 * 0;
+}
+	v0_0 = p0 / 7;
+	input $$ v0_0 $$;
+	v0_0 = p0 / 0;
+	/* c */
+	v0_0 = 100;
+	output $$ v0_0 $$;
+	if (p1 > v0_0)
+{
+
+}
+else
+{
+v0_0 = $ f0() $;
+	/* multi
+ line { } comment */
+	if (v0_0 < p1)
+{
+output $$ v0_0 $$;
+}
+	/* multi
+ line { } comment */
+}
+	/* multi
+ line { } comment */
+	v0_0 = 5;
+	v0_0 = v0_0 - -3;
+	v0_0 = p0;
+	v0_0 = v0_0 * v0_0;
+	v0_0 = p0 + p0;
+	v0_0 = v0_0;
+	if (v0_0 == p1)
+{
+
+}
+	v0_0 = v0_0 / -3;
+	while (p0 < p0) {
+v0_0 = p1 * p1;
+}
+	v0_0 = v0_0 + 0;
+	/**/
+	return p0;
+}
+
+
+int f3()
+{
+	int v0_0;
+	/**/
+	output $$ v0_0 $$;
+	v0_0 = v0_0;
+	/* * / { */
+	v0_0 = $ f1(4) $;
+	int v0_1;
+	/* * / { */
+	v0_0 = v0_1 % 7;
+	v0_0 = -11;
+	v0_0 = v0_1 + 0;
+	v0_0 = v0_0 + 0;
+	/**/
+	v0_0 = v0_1 * 0;
+	output $$ v0_1 $$;
+	/**/
+	v0_0 = v0_0;
+	input $$ v0_0 $$;
+	input $$ v0_0 $$;
+	v0_0 = $ f0() $;
+	int v0_2;
+	v0_1 = 5;
+	int v0_3;
+	int v0_4;
+	/* c */
+	v0_2 = v0_2 / v0_3;
+}
+
+
+int main()
+{
+	int v0_0;
+	int v0_1;
+	input $$ v0_1 $$;
+	/* * / { */
+	if (v0_1 < v0_1)
+{
+input $$ v0_0 $$;
+}
+else
+{
+
+}
+	int v0_2;
+	/**/
+	v0_2 = 0;
+	/**/
+	if (v0_2 < v0_2)
+{
+int v1_0;
+	/* multi
+ line { } comment */
+	v0_2 = v0_1 % v0_1;
+	if (v0_1 == v0_0)
+{
+if (v0_0 == v0_0)
+{
+int v3_0;
+	/* * / { */
+}
+	v0_1 = v0_2;
+	v0_0 = v1_0 / v0_2;
+	v1_0 = $ f1(v0_2) $;
+}
+else
+{
+v1_0 = v0_2 - -3;
+}
+	/* multi
+ line { } comment */
+	v0_1 = v0_1 - -3;
+}
+	v0_0 = 5;
+	if (v0_0 < v0_0)
+{
+v0_1 = v0_1;
+	/* * / { */
+	v0_1 = v0_1;
+}
+else
+{
+
+}
+	/* c */
+	v0_2 = v0_1 / v0_1;
+	v0_2 = $ f2(v0_2, v0_2) $;
+	/**/
+	v0_1 = v0_1 - -3;
+	v0_1 = $ f0() $;
+	/* * / { */
+	v0_0 = v0_0 + 12;
+	/* multi
+ line { } comment */
+	int v0_3;
+	v0_2 = v0_3 / -3;
+	v0_0 = v0_0 / -3;
+	v0_1 = v0_2 % v0_3;
+	v0_1 = v0_2 % v0_0;
+	while (v0_1 == v0_2) {
+v0_3 = v0_0 + 12;
+	v0_2 = -11;
+	/**/
+	v0_3 = v0_3 / v0_2;
+}
+}
@@ -0,0 +1,395 @@
+
+void f0(int p0, int p1)
+{
+	int v0_0;
+	v0_0 = p1;
+	v0_0 = p0 + p1;
+	v0_0 = v0_0 % p0;
+	/* multi
+ line { } comment */
+	v0_0 = p0 / 12;
+	int v0_1;
+	v0_0 = p1 + p0;
+	v0_0 = p1;
+	/* multi
+ line { } comment */
+	v0_0 = -11;
+	if (v0_1 > p0)
+{
+v0_1 = p1 + 7;
+	if (p0 == v0_0)
+{
+
+}
+else
+{
+v0_1 = -11;
+	if (p0 > p0)
+{
+input $$ v0_0 $$;
+	v0_0 = v0_1 / p0;
+}
+}
+	/* multi
+ line { } comment */
+}
+	v0_0 = v0_0 / 7;
+	while (v0_0 > p0) {
+v0_0 = p1;
+	if (p1 > v0_0)
+{
+int v2_0;
+	v0_1 = p0 * v0_0;
+	/* c */
+	int v2_1;
+	output $$ v0_0 $$;
+	/**/
+}
+	v0_1 = p0 / p0;
+}
+	/* multi
+ line { } comment */
+	if (v0_1 < p1)
+{
+v0_0 = p0 * 0;
+	v0_0 = v0_1;
+	if (v0_0 > v0_0)
+{
+v0_0 = 5;
+	v0_0 = v0_1;
+}
+else
+{
+v0_0 = v0_0 * p1;
+	v0_1 = v0_0 * 12;
+	v0_1 = p1 / p0;
+}
+	/**/
+}
+	while (v0_0 > v0_0) {
+v0_1 = p1 * 12;
+	v0_0 = -11;
+	output $$ v0_1 $$;
+	/* c */
+}
+	while (p1 == v0_1) {
+if (v0_0 == p0)
+{
+v0_0 = v0_1 - v0_0;
+}
+else
+{
+v0_0 = p0;
+	int v2_0;
+	v2_0 = 5;
+}
+	if (p0 == p1)
+{
+if (v0_0 < v0_0)
+{
+v0_1 = p0;
+	v0_0 = 100;
+	/**/
+	v0_1 = v0_0;
+}
+else
+{
+v0_0 = 0;
+	v0_0 = p0;
+}
+}
+else
+{
+
+}
+}
+	v0_1 = 0;
+	v0_1 = v0_0;
+	if (v0_1 < v0_0)
+{
+v0_1 = 5;
+	v0_1 = v0_0;
+	/* c */
+}
+else
+{
+v0_0 = p0 / v0_0;
+	if (p1 > p0)
+{
+v0_0 = 100;
+	/* * / { */
+}
+	output $$ v0_0 $$;
+	/* multi
+ line { } comment */
+}
+	v0_1 = 100;
+	int v0_2;
+}
+
+/* * / { */
+int f1(int p0, int p1)
+{
+	int v0_0;
+	/* * / { */
+	if (p0 == v0_0)
+{
+int v1_0;
+}
+else
+{
+input $$ v0_0 $$;
+	if (v0_0 < p1)
+{
+input $$ v0_0 $$;
+	int v2_0;
+	v0_0 = $ f0(v0_0, p1) $;
+}
+	v0_0 = p0 % 7;
+	/* multi
+ line { } comment */
+}
+	/* c */
+	while (v0_0 < p1) {
+v0_0 = v0_0;
+	int v1_0;
+	/* c */
+	if (p1 > v1_0)
+{
+v0_0 = p1 - 0;
+}
+else
+{
+
+}
+}
+	v0_0 = v0_0 + -3;
+	int v0_1;
+	v0_1 = v0_1 * 12;
+	int v0_2;
+	/**/
+	output $$ v0_2 $$;
+	v0_1 = p0 - 12;
+	v0_1 = p1 * v0_1;
+	v0_2 = p0 + 7;
+	int v0_3;
+	/* * / { */
+	v0_0 = v0_1 * -3;
+	int v0_4;
+	int v0_5;
+	/* * / { */
+	if (v0_1 == p1)
+{
+
+}
+	input $$ v0_1 $$;
+	v0_4 = v0_1 * v0_2;
+	while (v0_4 < v0_3) {
+input $$ v0_3 $$;
+	v0_1 = p0 % -3;
+}
+	int v0_6;
+	/* multi
+ line { } comment */
+	return p0;
+}
+
+
+void f2(int p0)
+{
+	int v0_0;
+	output $$ v0_0 $$;
+	v0_0 = -11;
+	int v0_1;
+	input $$ v0_1 $$;
+	/**/
+	int v0_2;
+	while (v0_0 < v0_2) {
+
+}
+	while (v0_1 < p0) {
+v0_0 = 5;
+	v0_0 = v0_2 - v0_2;
+	/* c */
+	v0_2 = $ f0(4, v0_2) $;
+}
+	v0_1 = 5;
+	if (v0_0 < v0_0)
+{
+v0_2 = v0_2;
+}
+else
+{
+int v1_0;
+	v0_2 = p0 % p0;
+	if (v0_0 > p0)
+{
+int v2_0;
+	/* c */
+	v0_0 = 5;
+	/* * / { */
+	v0_1 = v2_0 + p0;
+	/* * / { */
+}
+else
+{
+int v2_0;
+}
+	/* multi
+ line { } comment */
+}
+	input $$ v0_0 $$;
+	v0_2 = v0_1 / 12;
+	v0_0 = 5;
+	v0_0 = v0_2 % v0_2;
+	/* * / { */
+	int v0_3;
+	input $$ v0_2 $$;
+	/* c */
+	v0_0 = 0;
+	if (v0_1 < v0_2)
+{
+int v1_0;
+	/**/
+}
+	int v0_4;
+	v0_1 = v0_3 * p0;
+}
+
+/* * / { */
+int f3(int p0, int p1)
+{
+	int v0_0;
+	v0_0 = p1 - -3;
+	/* multi
+ line { } comment */
+	int v0_1;
+	v0_0 = p0 % p1;
+	/* c */
+	v0_1 = v0_1;
+	v0_0 = p1;
+	int v0_2;
+	/**/
+	int v0_3;
+	input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	if (p1 > v0_1)
+{
+int v1_0;
+	output $$ v0_3 $$;
+	v1_0 = p0 - 12;
+}
+else
+{
+
+}
+	/* * / { */
+	if (p1 < p0)
+{
+v0_3 = v0_3 / v0_3;
+	/**/
+	input $$ v0_2 $$;
+	v0_1 = p1 * v0_3;
+	if (p0 == v0_1)
+{
+v0_3 = p1 / v0_1;
+	/* multi
+ line { } comment */
+	v0_2 = v0_3 - v0_2;
+	v0_0 = -11;
+}
+else
+{
+input $$ v0_0 $$;
+}
+	/**/
+}
+	v0_3 = 0;
+	input $$ v0_0 $$;
+	while (v0_0 == p0) {
+v0_0 = v0_0 + p1;
+	v0_2 = $ f2(v0_1) $;
+	int v1_0;
+	v0_2 = p0 * p1;
+}
+	while (v0_2 == p1) {
+v0_0 = -11;
+	while (v0_1 > p0) {
+v0_2 = v0_3 - 0;
+	int v2_0;
+	v0_1 = $ f2(v0_3) $;
+}
+	/**/
+	while (v0_2 < p1) {
+
+}
+}
+	v0_3 = p0 % 12;
+	v0_2 = v0_2 - 12;
+	int v0_4;
+	v0_0 = v0_1 - p0;
+	/* multi
+ line { } comment */
+	v0_2 = v0_0 + 0;
+	return p0;
+}
+
+/* * / { */
+int main()
+{
+	int v0_0;
+	if (v0_0 == v0_0)
+{
+
+}
+else
+{
+int v1_0;
+}
+	while (v0_0 == v0_0) {
+if (v0_0 > v0_0)
+{
+
+}
+else
+{
+v0_0 = v0_0 - v0_0;
+	v0_0 = 5;
+}
+}
+	/* c */
+	v0_0 = 5;
+	output $$ v0_0 $$;
+	/* * / { */
+	v0_0 = v0_0;
+	v0_0 = v0_0 % v0_0;
+	/**/
+	v0_0 = v0_0;
+	/* * / { */
+	v0_0 = v0_0;
+	/* c */
+	v0_0 = $ f3(v0_0, 4) $;
+	/**/
+	int v0_1;
+	/* multi
+ line { } comment */
+	v0_1 = v0_0 * v0_0;
+	input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	v0_0 = v0_1 / v0_0;
+	v0_0 = $ f3(4, v0_0) $;
+	/* * / { */
+	input $$ v0_0 $$;
+	/* * / { */
+	while (v0_1 > v0_1) {
+
+}
+	while (v0_1 < v0_1) {
+v0_1 = v0_0 - 7;
+}
+	/* * / { */
+	v0_0 = v0_0 + 12;
+	int v0_2;
+}
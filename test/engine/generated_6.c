@@ -0,0 +1,399 @@
+
+int f0(int p0, int p1)
+{
+	int v0_0;
+	/* c */
+	int v0_1;
+	v0_1 = v0_0;
+	v0_0 = p1 % 0;
+	/**/
+	if (p0 > v0_0)
+{
+
+}
+else
+{
+input $$ v0_1 $$;
+	while (v0_0 < p0) {
+output $$ v0_1 $$;
+	input $$ v0_0 $$;
+	if (p0 == v0_0)
+{
+if (v0_0 > p0)
+{
+
+}
+}
+else
+{
+v0_0 = p1 / 0;
+	/* multi
+ line { } comment */
+	input $$ v0_0 $$;
+	/* multi
+ line { } comment */
+}
+	/**/
+	if (v0_0 > v0_1)
+{
+v0_0 = p1 + 12;
+	while (v0_1 < v0_1) {
+input $$ v0_0 $$;
+}
+	output $$ v0_1 $$;
+	v0_1 = p0 / 0;
+}
+else
+{
+
+}
+	/**/
+}
+	while (p1 < p0) {
+int v2_0;
+	v0_1 = v0_0 / 12;
+	v0_1 = v0_1 % -3;
+	/* * / { */
+	if (v0_1 < v0_1)
+{
+v2_0 = v0_1 * 7;
+	/* * / { */
+	if (v0_0 > v0_1)
+{
+input $$ v0_0 $$;
+	v0_0 = p0 + 0;
+	/* c */
+	input $$ v0_1 $$;
+}
+	int v3_0;
+	/**/
+}
+}
+}
+	v0_1 = -11;
+	/**/
+	v0_0 = v0_0;
+	/* c */
+	if (p0 == v0_1)
+{
+while (p0 == p0) {
+int v2_0;
+	int v2_1;
+	output $$ v2_1 $$;
+	int v2_2;
+}
+	v0_1 = v0_1 / 12;
+	v0_0 = 100;
+}
+else
+{
+
+}
+	/**/
+	v0_1 = v0_1 / 0;
+	/* c */
+	v0_1 = p1 - p0;
+	int v0_2;
+	while (p1 == v0_1) {
+output $$ v0_0 $$;
+	int v1_0;
+}
+	v0_0 = -11;
+	/* c */
+	v0_2 = p1 * v0_0;
+	/* * / { */
+	while (p1 == v0_2) {
+v0_2 = p1 - 7;
+}
+	if (p1 > v0_1)
+{
+v0_2 = v0_1 % 12;
+	/* multi
+ line { } comment */
+	if (v0_0 > p1)
+{
+v0_0 = p1 + -3;
+	/* * / { */
+}
+	/* c */
+	if (v0_2 < p0)
+{
+v0_2 = v0_1 % v0_1;
+	v0_0 = v0_1 % p1;
+	/* * / { */
+	int v2_0;
+	/* multi
+ line { } comment */
+	int v2_1;
+}
+	while (v0_0 > v0_1) {
+v0_2 = v0_2 * v0_1;
+	/**/
+}
+}
+else
+{
+
+}
+	if (p1 < v0_0)
+{
+v0_0 = p0 - 7;
+	/* c */
+	v0_1 = 100;
+	/**/
+}
+else
+{
+v0_2 = p1 / v0_1;
+}
+	input $$ v0_1 $$;
+	/**/
+	output $$ v0_0 $$;
+	int v0_3;
+	/* c */
+	return p0;
+}
+
+
+int f1()
+{
+	int v0_0;
+	v0_0 = -11;
+	output $$ v0_0 $$;
+	v0_0 = 100;
+	v0_0 = v0_0 % -3;
+	/**/
+	v0_0 = v0_0 % 12;
+	int v0_1;
+	int v0_2;
+	input $$ v0_2 $$;
+	int v0_3;
+	v0_2 = v0_2;
+	v0_1 = $ f0(v0_0, v0_2) $;
+	/* multi
+ line { } comment */
+	input $$ v0_0 $$;
+	while (v0_0 < v0_0) {
+v0_1 = v0_1 - v0_3;
+	/* multi
+ line { } comment */
+}
+	while (v0_3 == v0_0) {
+int v1_0;
+	v0_2 = v0_2 * v0_2;
+	v0_3 = v0_0 + v0_0;
+	v0_0 = 5;
+	/* c */
+}
+	if (v0_0 == v0_2)
+{
+input $$ v0_1 $$;
+}
+	while (v0_1 < v0_3) {
+int v1_0;
+	v1_0 = v0_3;
+	/* * / { */
+}
+	/* multi
+ line { } comment */
+	while (v0_1 > v0_2) {
+input $$ v0_2 $$;
+	/**/
+	v0_0 = -11;
+}
+	int v0_4;
+	v0_4 = 100;
+	/* c */
+}
+
+
+void f2()
+{
+	int v0_0;
+	/**/
+	while (v0_0 < v0_0) {
+int v1_0;
+	input $$ v0_0 $$;
+	v0_0 = 0;
+	v1_0 = 5;
+}
+	/* * / { */
+	int v0_1;
+	v0_0 = v0_1 - 7;
+	if (v0_1 == v0_1)
+{
+v0_0 = v0_1 * 12;
+	v0_0 = 100;
+	/**/
+}
+	int v0_2;
+	int v0_3;
+	int v0_4;
+	v0_2 = v0_0 * v0_4;
+	v0_2 = $ f0(4, v0_0) $;
+	v0_0 = v0_2 - v0_4;
+	while (v0_4 > v0_1) {
+while (v0_0 < v0_2) {
+v0_3 = $ f0(v0_3, v0_2) $;
+	/**/
+}
+}
+	v0_2 = v0_0 % v0_3;
+	output $$ v0_3 $$;
+	v0_2 = 0;
+	/* multi
+ line { } comment */
+	v0_1 = -11;
+	v0_4 = $ f1() $;
+	v0_1 = v0_4 % v0_3;
+	v0_2 = v0_3 + v0_1;
+	v0_2 = 0;
+}
+
+
+void f3(int p0, int p1)
+{
+	int v0_0;
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 / 0;
+	/* multi
+ line { } comment */
+	v0_0 = p1 / 0;
+	/* * / { */
+	v0_0 = p0;
+	v0_0 = 5;
+	v0_0 = p1;
+	/* multi
+ line { } comment */
+	v0_0 = 0;
+	int v0_1;
+	if (v0_0 == v0_0)
+{
+v0_1 = p0 / -3;
+	/**/
+	int v1_0;
+	v1_0 = p0 / p0;
+	/* * / { */
+}
+else
+{
+v0_0 = v0_0 + v0_0;
+	/* multi
+ line { } comment */
+	input $$ v0_1 $$;
+	v0_1 = v0_0 * v0_0;
+}
+	output $$ v0_0 $$;
+	v0_0 = p0 + 0;
+	int v0_2;
+	while (v0_2 < v0_2) {
+v0_2 = $ f1() $;
+	/* multi
+ line { } comment */
+	while (p0 < v0_0) {
+v0_1 = -11;
+}
+	/* c */
+	v0_2 = p1 / v0_1;
+	if (v0_2 > p0)
+{
+input $$ v0_2 $$;
+	output $$ v0_0 $$;
+	v0_2 = v0_0 * -3;
+}
+else
+{
+v0_1 = v0_0 / v0_1;
+	if (v0_0 > v0_0)
+{
+v0_0 = v0_2 * -3;
+	if (v0_0 == p1)
+{
+v0_0 = 5;
+	/* multi
+ line { } comment */
+	v0_1 = 5;
+	v0_0 = 5;
+	int v4_0;
+}
+	int v3_0;
+}
+	v0_2 = v0_0 % p1;
+}
+	/* c */
+}
+	/* multi
+ line { } comment */
+	v0_1 = v0_1 % p0;
+	output $$ v0_2 $$;
+	v0_0 = v0_2 + p0;
+	input $$ v0_2 $$;
+	/* multi
+ line { } comment */
+	v0_1 = v0_0 % v0_0;
+	v0_0 = $ f0(p1, p0) $;
+	v0_2 = $ f0(p0, p0) $;
+	/**/
+}
+
+
+int main(int p0)
+{
+	int v0_0;
+	v0_0 = v0_0 % -3;
+	/* c */
+	input $$ v0_0 $$;
+	v0_0 = v0_0 % 7;
+	/* c */
+	int v0_1;
+	/* * / { */
+	if (v0_1 < v0_1)
+{
+
+}
+else
+{
+input $$ v0_0 $$;
+}
+	/* * / { */
+	if (v0_1 == p0)
+{
+v0_0 = 5;
+}
+	v0_1 = p0 / 7;
+	v0_0 = v0_1 - 0;
+	if (v0_0 == v0_1)
+{
+
+}
+else
+{
+input $$ v0_0 $$;
+	v0_1 = v0_0 % 12;
+}
+	/* * / { */
+	if (v0_0 > v0_0)
+{
+int v1_0;
+}
+	/**/
+	v0_0 = 5;
+	int v0_2;
+	input $$ v0_1 $$;
+	/* c */
+	int v0_3;
+	/* c */
+	v0_1 = v0_0 + v0_2;
+	int v0_4;
+	if (v0_2 < p0)
+{
+v0_3 = $ f1() $;
+	v0_4 = v0_2;
+	/* * / { */
+}
+	v0_4 = 5;
+	v0_2 = v0_0 - p0;
+	/* c */
+	return p0;
+}
@@ -0,0 +1,858 @@
+
+int f0(int p0)
+{
+	int v0_0;
+	/* c */
+	v0_0 = p0 - 0;
+	/* * / { */
+	int v0_1;
+	/* * / { */
+	int v0_2;
+	v0_2 = p0;
+	v0_0 = v0_0 % p0;
+	/* multi
+ line { } comment */
+	v0_2 = 100;
+	if (p0 == v0_0)
+{
+int v1_0;
+	if (v1_0 < v0_2)
+{
+v1_0 = v0_1 % 0;
+	v0_2 = v0_0 + v0_2;
+	output $$ v1_0 $$;
+	/* c */
+	int v2_0;
+}
+	/* * / { */
+}
+else
+{
+
+}
+	if (v0_1 > v0_1)
+{
+v0_1 = 5;
+	v0_1 = p0;
+	/**/
+	if (v0_2 > v0_2)
+{
+int v2_0;
+	v0_1 = p0 + 0;
+}
+else
+{
+v0_1 = v0_2 - v0_0;
+}
+	/* multi
+ line { } comment */
+	input $$ v0_2 $$;
+	/* * / { */
+}
+	v0_0 = v0_0 + v0_1;
+	/* multi
+ line { } comment */
+	int v0_3;
+	v0_3 = v0_1 - p0;
+	if (v0_1 < v0_3)
+{
+if (p0 > v0_3)
+{
+v0_3 = v0_2 / v0_0;
+	/* c */
+	v0_3 = v0_0;
+	/* c */
+	int v2_0;
+}
+	if (p0 < v0_3)
+{
+int v2_0;
+	/**/
+	if (v0_2 < p0)
+{
+v0_3 = v0_2;
+	int v3_0;
+	/**/
+	while (v0_2 == v0_0) {
+int v4_0;
+	v0_1 = 5;
+	v2_0 = v0_0 * 12;
+	v4_0 = v0_2 % 7;
+}
+}
+	while (v0_0 < v0_2) {
+v0_0 = v0_2 + v2_0;
+}
+}
+else
+{
+v0_1 = v0_1 + 7;
+	/* * / { */
+	v0_0 = v0_0 % 0;
+}
+	while (p0 == p0) {
+while (v0_0 > v0_0) {
+while (v0_1 < v0_2) {
+v0_1 = p0 - v0_1;
+	/* * / { */
+	input $$ v0_1 $$;
+	input $$ v0_3 $$;
+}
+	v0_1 = 5;
+	/* c */
+	v0_1 = 0;
+}
+	/* multi
+ line { } comment */
+	int v2_0;
+	/* multi
+ line { } comment */
+	while (v0_1 > v0_3) {
+input $$ v0_0 $$;
+	v0_3 = v0_2 % 12;
+	output $$ v0_1 $$;
+}
+}
+	/* * / { */
+	while (v0_3 < v0_0) {
+int v2_0;
+}
+	/* c */
+}
+else
+{
+while (p0 == p0) {
+v0_3 = p0 % v0_0;
+}
+	output $$ v0_3 $$;
+	v0_1 = v0_1;
+}
+	v0_1 = 100;
+	output $$ v0_1 $$;
+	int v0_4;
+	/* * / { */
+	v0_0 = v0_4 / v0_2;
+	/**/
+	while (v0_0 == v0_4) {
+int v1_0;
+	v0_1 = v0_4;
+}
+	v0_1 = -11;
+	v0_3 = v0_1;
+	v0_2 = p0 + v0_4;
+	v0_4 = p0 * 7;
+	v0_0 = 5;
+	while (p0 < v0_1) {
+int v1_0;
+	v0_3 = v0_0 * v1_0;
+	/* * / { */
+}
+	int v0_5;
+	/* multi
+ line { } comment */
+	v0_5 = p0 + v0_3;
+	/**/
+	int v0_6;
+	int v0_7;
+	v0_5 = 0;
+	v0_3 = v0_1 % p0;
+	return p0;
+}
+
+
+int f1(int p0)
+{
+	int v0_0;
+	if (p0 > v0_0)
+{
+if (v0_0 > p0)
+{
+int v2_0;
+	/* multi
+ line { } comment */
+	v0_0 = 0;
+	/* * / { */
+}
+	output $$ v0_0 $$;
+	v0_0 = p0;
+	if (p0 > v0_0)
+{
+
+}
+	/**/
+}
+else
+{
+
+}
+	/* * / { */
+	output $$ v0_0 $$;
+	if (p0 > p0)
+{
+v0_0 = p0 * 7;
+}
+	/**/
+	v0_0 = p0 * p0;
+	/**/
+	v0_0 = -11;
+	int v0_1;
+	/* c */
+	int v0_2;
+	v0_0 = v0_1 - 7;
+	v0_0 = 0;
+	while (v0_2 < v0_1) {
+if (p0 == v0_2)
+{
+int v2_0;
+	v0_0 = -11;
+	/* c */
+	int v2_1;
+	int v2_2;
+}
+	if (v0_0 > v0_1)
+{
+
+}
+else
+{
+
+}
+	v0_2 = 5;
+	int v1_0;
+}
+	/* c */
+	input $$ v0_0 $$;
+	v0_0 = v0_2 / 12;
+	if (p0 == v0_0)
+{
+
+}
+	if (v0_1 == v0_0)
+{
+
+}
+else
+{
+v0_1 = p0 / v0_2;
+	v0_2 = v0_2 + 12;
+	/* c */
+	output $$ v0_0 $$;
+	/* c */
+}
+	v0_1 = v0_1;
+	output $$ v0_0 $$;
+	/* c */
+	int v0_3;
+	v0_1 = v0_3;
+	v0_0 = 100;
+	/* * / { */
+	v0_3 = v0_0 / p0;
+	while (v0_2 > v0_2) {
+int v1_0;
+	v0_1 = v0_1 + 7;
+}
+	v0_3 = v0_1 / v0_0;
+	v0_2 = $ f0(v0_2) $;
+	v0_1 = p0 - v0_3;
+	v0_3 = v0_1 * v0_2;
+	input $$ v0_3 $$;
+	v0_1 = p0;
+	/* * / { */
+	v0_1 = 100;
+	output $$ v0_1 $$;
+	/* * / { */
+	return p0;
+}
+
+/* * / { */
+void f2(int p0)
+{
+	int v0_0;
+	v0_0 = p0 / 7;
+	/* multi
+ line { } comment */
+	int v0_1;
+	input $$ v0_0 $$;
+	v0_0 = v0_0 - 7;
+	/* multi
+ line { } comment */
+	v0_1 = p0 - v0_1;
+	/* multi
+ line { } comment */
+	output $$ v0_1 $$;
+	while (p0 > v0_0) {
+while (v0_0 > v0_1) {
+int v2_0;
+	if (v0_0 < v0_1)
+{
+v0_0 = v2_0 * 0;
+	/* * / { */
+}
+}
+	v0_1 = $ f0(p0) $;
+}
+	v0_1 = 0;
+	/* c */
+	v0_1 = p0 + -3;
+	/* c */
+	int v0_2;
+	/* c */
+	if (v0_1 < v0_1)
+{
+if (p0 < p0)
+{
+v0_2 = -11;
+	v0_1 = p0 % p0;
+}
+else
+{
+if (v0_0 > v0_0)
+{
+v0_0 = v0_2 + 7;
+	/* * / { */
+	int v3_0;
+	/* * / { */
+	output $$ v0_1 $$;
+	if (v0_2 > v0_2)
+{
+int v4_0;
+	/* c */
+}
+else
+{
+v0_1 = v0_0 / v0_2;
+	/**/
+}
+	/* * / { */
+}
+	v0_2 = 5;
+}
+	/* * / { */
+	int v1_0;
+	/* multi
+ line { } comment */
+	v1_0 = p0 / v0_1;
+	output $$ v0_0 $$;
+}
+	v0_2 = v0_2 * p0;
+	input $$ v0_1 $$;
+	int v0_3;
+	/* c */
+	v0_3 = p0 - 12;
+	input $$ v0_3 $$;
+	/* * / { */
+	v0_2 = v0_3 - 0;
+	output $$ v0_0 $$;
+	v0_0 = v0_2 / p0;
+	input $$ v0_0 $$;
+	/* c */
+	output $$ v0_2 $$;
+	v0_2 = v0_3 * p0;
+	v0_1 = v0_3 + v0_0;
+	/* * / { */
+	v0_3 = v0_1;
+	input $$ v0_1 $$;
+	v0_1 = v0_1 % v0_1;
+	v0_1 = v0_1 % v0_0;
+	v0_3 = v0_2 + v0_0;
+	v0_2 = v0_2 + v0_0;
+}
+
+
+void f3(int p0)
+{
+	int v0_0;
+	/* * / { */
+	if (p0 == p0)
+{
+v0_0 = v0_0 * 7;
+	/* multi
+ line { } comment */
+	v0_0 = p0 * v0_0;
+}
+else
+{
+v0_0 = 5;
+}
+	int v0_1;
+	input $$ v0_1 $$;
+	int v0_2;
+	/* c */
+	int v0_3;
+	input $$ v0_1 $$;
+	v0_2 = v0_0 % 0;
+	if (p0 < v0_3)
+{
+v0_1 = p0 * 7;
+	/**/
+	int v1_0;
+	output $$ v0_0 $$;
+	v0_2 = v0_1 % v0_1;
+	/* c */
+}
+	int v0_4;
+	/* * / { */
+	if (v0_0 == v0_3)
+{
+
+}
+	v0_0 = v0_1 / v0_3;
+	v0_3 = $ f1(v0_2) $;
+	/**/
+	if (v0_2 == v0_2)
+{
+v0_3 = v0_0;
+}
+	output $$ v0_3 $$;
+	int v0_5;
+	/* multi
+ line { } comment */
+	if (v0_2 < v0_3)
+{
+output $$ v0_5 $$;
+	int v1_0;
+	/* multi
+ line { } comment */
+	output $$ v0_0 $$;
+	while (v0_2 > v0_1) {
+
+}
+}
+else
+{
+
+}
+	if (p0 == v0_3)
+{
+if (v0_5 < v0_3)
+{
+v0_1 = $ f0(4) $;
+	int v2_0;
+	v0_1 = v0_4 - v0_0;
+}
+	/* c */
+}
+	v0_5 = v0_2 * -3;
+	v0_5 = $ f1(v0_5) $;
+	v0_1 = 5;
+	/* * / { */
+	v0_3 = 0;
+	input $$ v0_3 $$;
+	/* multi
+ line { } comment */
+	v0_4 = v0_1 / v0_0;
+	int v0_6;
+	int v0_7;
+	while (v0_7 < p0) {
+output $$ v0_2 $$;
+	/* c */
+	v0_1 = v0_2;
+	/* * / { */
+	v0_1 = v0_1 - -3;
+	v0_5 = $ f1(v0_1) $;
+}
+	/* * / { */
+	int v0_8;
+	output $$ v0_3 $$;
+	v0_5 = $ f0(v0_4) $;
+	/* multi
+ line { } comment */
+}
+
+/* multi
+ line { } comment */
+void f4(int p0, int p1)
+{
+	int v0_0;
+	v0_0 = p1 % p0;
+	v0_0 = p1 % -3;
+	/* * / { */
+	while (p1 > p1) {
+v0_0 = $ f2(v0_0) $;
+	v0_0 = v0_0 * p0;
+}
+	output $$ v0_0 $$;
+	while (p0 < p1) {
+if (p1 == p1)
+{
+
+}
+else
+{
+v0_0 = $ f0(p0) $;
+	/**/
+}
+	v0_0 = 0;
+	v0_0 = $ f1(v0_0) $;
+	/* c */
+	output $$ v0_0 $$;
+}
+	int v0_1;
+	/**/
+	v0_1 = v0_0 + p0;
+	v0_0 = $ f3(p1) $;
+	int v0_2;
+	v0_0 = p1 + v0_0;
+	/* multi
+ line { } comment */
+	int v0_3;
+	/* * / { */
+	input $$ v0_1 $$;
+	int v0_4;
+	v0_3 = v0_3;
+	v0_3 = v0_1 + 7;
+	/* c */
+	v0_2 = v0_3 + p0;
+	output $$ v0_2 $$;
+	v0_4 = v0_2 / 12;
+	v0_0 = p1 % p1;
+	/* multi
+ line { } comment */
+	input $$ v0_1 $$;
+	while (v0_0 < v0_1) {
+v0_3 = $ f3(4) $;
+	if (v0_4 < v0_1)
+{
+v0_3 = $ f2(v0_1) $;
+}
+else
+{
+int v2_0;
+	/* c */
+}
+}
+	/* multi
+ line { } comment */
+	if (p0 < p1)
+{
+
+}
+	int v0_5;
+	v0_0 = p1 / 12;
+	/* multi
+ line { } comment */
+	int v0_6;
+	/* c */
+	input $$ v0_5 $$;
+	v0_1 = 5;
+	if (v0_2 > v0_3)
+{
+v0_0 = v0_3 * v0_2;
+	v0_4 = v0_3 % 12;
+	v0_0 = p0 / 12;
+}
+	if (v0_6 == v0_1)
+{
+
+}
+	/* * / { */
+}
+
+/* c */
+int f5(int p0)
+{
+	int v0_0;
+	v0_0 = 0;
+	v0_0 = p0;
+	/* multi
+ line { } comment */
+	output $$ v0_0 $$;
+	int v0_1;
+	int v0_2;
+	if (p0 == v0_1)
+{
+int v1_0;
+	output $$ v0_0 $$;
+}
+	v0_2 = v0_2 / v0_1;
+	/* * / { */
+	int v0_3;
+	if (v0_3 == p0)
+{
+v0_2 = $ f4(v0_0, v0_2) $;
+	/* * / { */
+	if (v0_1 == v0_0)
+{
+v0_2 = v0_0 - 12;
+}
+}
+else
+{
+v0_2 = v0_3;
+}
+	/**/
+	v0_2 = p0;
+	/* c */
+	v0_2 = v0_0 * v0_1;
+	v0_3 = p0 - v0_3;
+	int v0_4;
+	v0_3 = v0_0 * 0;
+	/**/
+	v0_1 = $ f3(p0) $;
+	v0_1 = v0_3 / 12;
+	if (v0_4 == v0_3)
+{
+if (v0_4 < v0_2)
+{
+v0_1 = v0_4 / v0_0;
+	if (v0_4 < v0_1)
+{
+v0_0 = 0;
+	if (v0_0 == v0_1)
+{
+
+}
+else
+{
+output $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 * 0;
+	v0_1 = 0;
+}
+	input $$ v0_4 $$;
+}
+	v0_1 = v0_2;
+}
+}
+	v0_0 = v0_2 + 7;
+	/* * / { */
+	if (v0_4 > v0_3)
+{
+int v1_0;
+	v0_3 = v0_3 / v0_2;
+	/* multi
+ line { } comment */
+}
+	/* multi
+ line { } comment */
+	v0_4 = -11;
+	int v0_5;
+	input $$ v0_3 $$;
+	v0_3 = v0_3 - 12;
+	input $$ v0_2 $$;
+	if (v0_2 == v0_0)
+{
+int v1_0;
+	v0_2 = v0_2 * 0;
+	v0_1 = v0_0 * 0;
+}
+	/**/
+	while (v0_0 == v0_5) {
+if (p0 == p0)
+{
+v0_5 = v0_1;
+	/* c */
+}
+	v0_1 = v0_2 - v0_4;
+}
+	v0_5 = v0_4 + 0;
+	v0_5 = 100;
+	/* multi
+ line { } comment */
+	v0_5 = 0;
+	return p0;
+}
+
+
+void f6(int p0)
+{
+	int v0_0;
+	/* * / { */
+	v0_0 = $ f3(v0_0) $;
+	v0_0 = p0 % 0;
+	/**/
+	v0_0 = 100;
+	v0_0 = v0_0 + 12;
+	if (p0 < p0)
+{
+input $$ v0_0 $$;
+	v0_0 = 5;
+	/* * / { */
+}
+	input $$ v0_0 $$;
+	while (p0 > v0_0) {
+v0_0 = p0 * 7;
+	v0_0 = v0_0 * 0;
+}
+	v0_0 = v0_0 * 12;
+	if (p0 > v0_0)
+{
+v0_0 = $ f3(v0_0) $;
+	/* multi
+ line { } comment */
+	input $$ v0_0 $$;
+	if (v0_0 == p0)
+{
+output $$ v0_0 $$;
+	/* * / { */
+	if (p0 < p0)
+{
+
+}
+else
+{
+
+}
+	if (v0_0 < v0_0)
+{
+if (v0_0 < v0_0)
+{
+
+}
+else
+{
+v0_0 = $ f4(p0, v0_0) $;
+	input $$ v0_0 $$;
+	output $$ v0_0 $$;
+	/* * / { */
+}
+	v0_0 = v0_0;
+	v0_0 = 0;
+	/* multi
+ line { } comment */
+	if (v0_0 < p0)
+{
+
+}
+}
+else
+{
+
+}
+	/* c */
+	v0_0 = p0 - -3;
+}
+	int v1_0;
+}
+else
+{
+v0_0 = 5;
+	int v1_0;
+	/* c */
+	v0_0 = v0_0 % 0;
+}
+	v0_0 = $ f2(v0_0) $;
+	v0_0 = p0 - 7;
+	while (v0_0 > v0_0) {
+v0_0 = v0_0 + 0;
+	v0_0 = v0_0 / v0_0;
+}
+	output $$ v0_0 $$;
+	/* c */
+	v0_0 = v0_0 - -3;
+	/* multi
+ line { } comment */
+	input $$ v0_0 $$;
+	/* * / { */
+	v0_0 = p0 % 0;
+	v0_0 = p0 % 7;
+	v0_0 = 100;
+	int v0_1;
+	v0_1 = 5;
+	/**/
+	output $$ v0_1 $$;
+	v0_0 = $ f1(v0_0) $;
+	/**/
+	v0_0 = v0_1 / v0_1;
+	/* * / { */
+	v0_0 = p0 / v0_1;
+	/* c */
+	v0_0 = v0_1 + -3;
+	/* * / { */
+	v0_1 = $ f1(v0_1) $;
+	v0_0 = v0_0;
+	v0_0 = p0 + 7;
+	/**/
+	output $$ v0_1 $$;
+}
+
+
+void main()
+{
+	int v0_0;
+	int v0_1;
+	v0_1 = v0_0 % 12;
+	/* multi
+ line { } comment */
+	v0_0 = v0_0 - 12;
+	/**/
+	v0_0 = v0_0;
+	int v0_2;
+	if (v0_2 > v0_0)
+{
+
+}
+else
+{
+
+}
+	if (v0_1 == v0_2)
+{
+while (v0_0 > v0_1) {
+v0_1 = v0_0 / v0_2;
+	/* multi
+ line { } comment */
+	input $$ v0_2 $$;
+}
+	output $$ v0_0 $$;
+	/* multi
+ line { } comment */
+	int v1_0;
+}
+else
+{
+while (v0_0 > v0_0) {
+
+}
+}
+	input $$ v0_1 $$;
+	/**/
+	int v0_3;
+	/* c */
+	v0_1 = v0_3 / v0_2;
+	/* * / { */
+	v0_2 = v0_0 % 7;
+	v0_3 = v0_3 * v0_1;
+	int v0_4;
+	int v0_5;
+	if (v0_1 == v0_3)
+{
+int v1_0;
+	v0_3 = v0_2;
+}
+	/**/
+	v0_1 = v0_1 * v0_0;
+	int v0_6;
+	v0_6 = v0_1 + 7;
+	v0_1 = 100;
+	output $$ v0_1 $$;
+	/* multi
+ line { } comment */
+	int v0_7;
+	/* multi
+ line { } comment */
+	if (v0_3 == v0_1)
+{
+
+}
+	while (v0_2 < v0_2) {
+if (v0_3 == v0_4)
+{
+int v2_0;
+}
+	output $$ v0_5 $$;
+	input $$ v0_7 $$;
+	/* * / { */
+	output $$ v0_7 $$;
+	/**/
+}
+	/**/
+	int v0_8;
+	v0_5 = $ f6(v0_0) $;
+	v0_5 = v0_8 + v0_1;
+	input $$ v0_5 $$;
+	input $$ v0_0 $$;
+	/* c */
+	v0_7 = v0_7;
+}
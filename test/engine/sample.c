@@ -0,0 +1,102 @@
+/* add_i */
+int add_i(int a, int b, int c)
+{
+	int temp;
+	temp = a + b;
+	return temp;
+}
+
+/* sub_i */
+int sub_i(int a, int b)
+{
+	int temp;
+	temp = a - b;
+	return temp;
+}
+
+/* mul_i */
+int mul_i(int a, int b)
+{
+	int temp;
+	temp = a * b;
+	return temp;
+}
+
+/* div_i */
+int div_i(int a, int b)
+{
+	int temp;
+	temp = a / b;
+	return temp;
+}
+
+/* main */
+void main()
+{
+	int i1;
+	int i2;
+
+	int ri1;
+	int ri2;
+	int ri3;
+	int ri4;
+
+	i1 = -1;
+	i2 = 2;
+
+	ri1 = $ add_i(i1, i2) $;
+	ri2 = $ sub_i(i1, i2) $;
+	ri3 = $ mul_i(i1, i2) $;
+	ri4 = $ div_i(i1, i2) $;
+
+	int a;
+	int b;
+	int c;
+
+	c = a - b;
+	if (c == a)
+	{
+		/* empty */
+	}
+	c = a / b;
+	c = a * b;
+	c = a % b;
+	c = a + b;
+	if (c < a)
+	{
+		/* empty */
+	}
+	if (c > a)
+	{
+		/* empty */
+	}
+	if (c == a)
+	{
+		/* empty */
+	}
+
+	a = 100;
+	b = 200;
+	c = 150;
+
+	input $$ a $$;
+
+	while (a < b)
+	{
+		a = a + 3;
+		if (a < c)
+		{
+			b = b + 2;
+		}
+		else
+		{
+			b = b + 1;
+		}
+	}
+
+	output $$ a $$;
+}
+
+/*
+	end
+*/
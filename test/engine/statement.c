@@ -0,0 +1,63 @@
+/* nested statements, and declarations in inner blocks which hide outer ones */
+int count(int n)
+{
+	int i;
+	int j;
+	int sum;
+	i = 0;
+	sum = 0;
+	while (i < n)
+	{
+		int k;
+		j = 0;
+		k = i * 2;
+		while (j < k)
+		{
+			if (j == sum)
+			{
+				sum = sum + 1;
+			}
+			else
+			{
+				if (j > sum)
+				{
+					int sum;
+					sum = j * 2;
+					output $$ sum $$;
+				}
+				else
+				{
+					sum = sum - 1;
+				}
+			}
+			j = j + 1;
+		}
+		i = i + 1;
+	}
+	return sum;
+}
+
+void main()
+{
+	int n;
+	int m;
+	input $$ n $$;
+	while (n > m)
+	{
+		m = $ count(n) $;
+		output $$ m $$;
+		n = n - 1;
+	}
+	if (n == m)
+	{
+	}
+	else
+	{
+		int n;
+		n = 1;
+		if (!n)
+		{
+			output $$ n $$;
+		}
+	}
+}
@@ -0,0 +1,293 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+class ThreadPool
+{
+public:
+	ThreadPool();
+	~ThreadPool();
+	void Start(int64_t thread_number);
+	void Stop();
+	void ParallelFor(int64_t task_number, const std::function<void(int64_t)> & task);
+	void ParallelTree(const std::vector<int64_t> & root_table, const std::function<void(int64_t, std::vector<int64_t> *)> & task);
+	// number of threads (including the calling thread)
+	int64_t thread_number_;
+private:
+	// queue of ready tasks of a thread: The thread takes the last one, and other threads steal the first one.
+	class Queue
+	{
+	public:
+		std::mutex mutex_;
+		std::deque<int64_t> task_table_;
+	};
+	void Work(int64_t thread);
+	void RunTask();
+	void RunTree(int64_t thread);
+	bool TakeTask(int64_t thread, int64_t * task_p);
+	// thread
+	std::vector<std::thread> thread_table_;
+	std::mutex mutex_;
+	std::condition_variable start_condition_;
+	std::condition_variable finish_condition_;
+	bool stop_;
+	// current job: tasks [0, task_number_) are taken by index
+	const std::function<void(int64_t)> * task_;
+	int64_t task_number_;
+	std::atomic<int64_t> task_index_;
+	int64_t generation_;
+	int64_t worker_running_;
+	// current job of function "ParallelTree": tasks in the queues, and tasks not finished (in queues or running)
+	const std::function<void(int64_t, std::vector<int64_t> *)> * tree_task_;
+	Queue * queue_table_;
+	std::atomic<int64_t> tree_task_number_;
+	// An idle thread sleeps until tasks are put into the queues or all tasks finish. "tree_ready_number_" (tasks in the queues) is increased with "tree_mutex_" held, so no wakeup is lost.
+	std::mutex tree_mutex_;
+	std::condition_variable tree_condition_;
+	std::atomic<int64_t> tree_ready_number_;
+};
+
+ThreadPool::ThreadPool()
+{
+	thread_number_ = 1;
+	stop_ = false;
+	task_ = NULL;
+	task_number_ = 0;
+	task_index_ = 0;
+	generation_ = 0;
+	worker_running_ = 0;
+	tree_task_ = NULL;
+	queue_table_ = NULL;
+	tree_task_number_ = 0;
+	tree_ready_number_ = 0;
+}
+
+ThreadPool::~ThreadPool()
+{
+	Stop();
+}
+
+void ThreadPool::Start(int64_t thread_number)
+{
+	if (thread_number <= 0)
+	{
+		throw std::exception("Function \"void ThreadPool::Start(int64_t thread_number)\" says: Invalid parameter \"thread_number\".");
+	}
+	Stop();
+	stop_ = false;
+	thread_number_ = thread_number;
+	// The calling thread works too, so only "thread_number - 1" threads are created.
+	for (int64_t i = 1; i < thread_number_; ++i)
+	{
+		thread_table_.push_back(std::thread(&ThreadPool::Work, this, i));
+	}
+}
+
+void ThreadPool::Stop()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	start_condition_.notify_all();
+	for (int64_t i = 0; i < thread_table_.size(); ++i)
+	{
+		thread_table_[i].join();
+	}
+	thread_table_.clear();
+	thread_number_ = 1;
+}
+
+void ThreadPool::ParallelFor(int64_t task_number, const std::function<void(int64_t)> & task)
+{
+	// Call "task(i)" for each i in [0, task_number) and return after all of them finish.
+	if (task_number <= 0)
+	{
+		return;
+	}
+	if (thread_table_.empty() || 1 == task_number)
+	{
+		for (int64_t i = 0; i < task_number; ++i)
+		{
+			task(i);
+		}
+		return;
+	}
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		task_ = &task;
+		task_number_ = task_number;
+		task_index_ = 0;
+		worker_running_ = thread_table_.size();
+		generation_ += 1;
+	}
+	start_condition_.notify_all();
+	RunTask();
+	// wait for workers
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (worker_running_ > 0)
+	{
+		finish_condition_.wait(lock);
+	}
+	task_ = NULL;
+}
+
+void ThreadPool::ParallelTree(const std::vector<int64_t> & root_table, const std::function<void(int64_t, std::vector<int64_t> *)> & task)
+{
+	// Call "task(i, &ready)" for each task of a forest and return after all of them finish. The roots are ready first, and a task puts the tasks it makes ready (its children) into "ready".
+	if (root_table.empty())
+	{
+		return;
+	}
+	// The roots are dealt to the queues, and a thread steals when its queue is empty.
+	std::vector<Queue> queue_table(thread_number_);
+	for (int64_t i = 0; i < root_table.size(); ++i)
+	{
+		queue_table[i % thread_number_].task_table_.push_back(root_table[i]);
+	}
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		tree_task_ = &task;
+		queue_table_ = &(queue_table[0]);
+		tree_task_number_ = root_table.size();
+		tree_ready_number_ = root_table.size();
+		worker_running_ = thread_table_.size();
+		generation_ += 1;
+	}
+	start_condition_.notify_all();
+	RunTree(0);
+	// wait for workers
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (worker_running_ > 0)
+	{
+		finish_condition_.wait(lock);
+	}
+	tree_task_ = NULL;
+	queue_table_ = NULL;
+}
+
+void ThreadPool::Work(int64_t thread)
+{
+	int64_t generation = 0;
+	bool is_tree;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (false == stop_ && generation == generation_)
+			{
+				start_condition_.wait(lock);
+			}
+			if (stop_)
+			{
+				return;
+			}
+			generation = generation_;
+			is_tree = NULL != tree_task_;
+		}
+		if (is_tree)
+		{
+			RunTree(thread);
+		}
+		else
+		{
+			RunTask();
+		}
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			worker_running_ -= 1;
+		}
+		finish_condition_.notify_one();
+	}
+}
+
+void ThreadPool::RunTask()
+{
+	for (int64_t i = task_index_++; i < task_number_; i = task_index_++)
+	{
+		(*task_)(i);
+	}
+}
+
+void ThreadPool::RunTree(int64_t thread)
+{
+	std::vector<int64_t> ready;
+	int64_t task;
+	while (tree_task_number_ > 0)
+	{
+		if (false == TakeTask(thread, &task))
+		{
+			// Other threads are running the rest, which may make more tasks ready: Sleep until then.
+			std::unique_lock<std::mutex> lock(tree_mutex_);
+			while (tree_task_number_ > 0 && tree_ready_number_ <= 0)
+			{
+				tree_condition_.wait(lock);
+			}
+			continue;
+		}
+		ready.clear();
+		(*tree_task_)(task, &ready);
+		// The ready tasks are counted before the finished one, so the count is never 0 too early.
+		if (false == ready.empty())
+		{
+			tree_task_number_ += ready.size();
+			{
+				std::unique_lock<std::mutex> lock(queue_table_[thread].mutex_);
+				queue_table_[thread].task_table_.insert(queue_table_[thread].task_table_.end(), ready.begin(), ready.end());
+			}
+			{
+				std::unique_lock<std::mutex> lock(tree_mutex_);
+				tree_ready_number_ += ready.size();
+			}
+			tree_condition_.notify_all();
+		}
+		if (0 == (tree_task_number_ -= 1))
+		{
+			// Wake the idle threads to return.
+			{
+				std::unique_lock<std::mutex> lock(tree_mutex_);
+			}
+			tree_condition_.notify_all();
+		}
+	}
+}
+
+bool ThreadPool::TakeTask(int64_t thread, int64_t * task_p)
+{
+	// the last task of its own queue, or the first task of another queue
+	Queue * queue_p;
+	for (int64_t i = 0; i < thread_number_; ++i)
+	{
+		queue_p = &(queue_table_[(thread + i) % thread_number_]);
+		std::unique_lock<std::mutex> lock(queue_p->mutex_);
+		if (queue_p->task_table_.empty())
+		{
+			continue;
+		}
+		if (0 == i)
+		{
+			*task_p = queue_p->task_table_.back();
+			queue_p->task_table_.pop_back();
+		}
+		else
+		{
+			*task_p = queue_p->task_table_.front();
+			queue_p->task_table_.pop_front();
+		}
+		tree_ready_number_ -= 1;
+		return true;
+	}
+	return false;
+}
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef TOKEN_STREAM_H_
+#define TOKEN_STREAM_H_
+
+#pragma warning(disable:4996)
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include "interner.h"
+
+class TokenStream
+{
+public:
+	// type of token
+	const static int64_t c_keyword_ = 0;
+	const static int64_t c_identifier_ = 1;
+	const static int64_t c_constant_int_ = 2;
+	const static int64_t c_operator_ = 3;
+	const static int64_t c_separator_ = 4;
+	// size of the buffer for function "CopyText"
+	const static int64_t c_text_size_ = 1024;
+	// size of a piece of a large block (in the shadow), which is analysed in parallel with the other pieces
+	const static int64_t c_piece_size_ = 1 << 20;
+	// perfect hash of keywords: "(text[0] + length) % c_keyword_slot_number_" is different for each keyword.
+	const static int64_t c_keyword_slot_number_ = 32;
+	// number of operators and separators in terminal symbols (from "$" to "}")
+	const static int64_t c_operator_symbol_number_ = 18;
+	static int64_t s_SearchKeyword(const char * text, int64_t length);
+	static int64_t s_GetSymbol(int64_t * type_p, const char * text, int64_t length);
+	TokenStream();
+	void SetText(const char * text);
+	void Append(int64_t type, int64_t location, int64_t text_index, int64_t length);
+	void RemoveBlank(bool is_block);
+	void Resize(int64_t size);
+	void Assign(int64_t index, const TokenStream * token_stream_p);
+	const char * GetText(int64_t index);
+	char * CopyText(int64_t index, char * buffer);
+	int64_t size_;
+	// text: Each token is a view of it (the shadow of the source file), and it is not terminated by '\0'.
+	const char * text_;
+	// token: parallel arrays
+	std::vector<unsigned char> type_table_;
+	std::vector<char> symbol_table_; // terminal symbol of function "ParseBlock", or -1
+	std::vector<int64_t> location_table_; // location in the source file (for errors)
+	std::vector<int64_t> text_table_; // beginning in "text_"
+	std::vector<int64_t> length_table_;
+	std::vector<int32_t> id_table_; // id of the spelling in "Interner::s_interner_" (only for identifiers), or -1
+private:
+	// keyword table: indexed by the perfect hash ("" in an empty slot)
+	static const char * const s_keyword_table_[c_keyword_slot_number_];
+	static const int64_t s_keyword_length_table_[c_keyword_slot_number_];
+	static const char s_keyword_symbol_table_[c_keyword_slot_number_];
+	// operator table: indexed by the first char, and built from "s_operator_description_"
+	static const char * const s_operator_description_[c_operator_symbol_number_];
+	static char s_operator_table_[256];
+	static char s_double_operator_table_[256];
+	static bool s_BuildOperatorTable();
+	static bool s_built_;
+};
+
+const char * const TokenStream::s_keyword_table_[c_keyword_slot_number_] =
+{
+	"", "", "", "", "", "", "", "",
+	"", "else", "", "if", "int", "", "input", "",
+	"", "", "", "", "", "output", "", "",
+	"return", "", "void", "", "while", "", "", ""
+};
+
+const int64_t TokenStream::s_keyword_length_table_[c_keyword_slot_number_] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4, 0, 2, 3, 0, 5, 0,
+	0, 0, 0, 0, 0, 6, 0, 0,
+	6, 0, 4, 0, 5, 0, 0, 0
+};
+
+// "void" has no terminal symbol.
+const char TokenStream::s_keyword_symbol_table_[c_keyword_slot_number_] =
+{
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 20, -1, 19, 18, -1, 23, -1,
+	-1, -1, -1, -1, -1, 24, -1, -1,
+	22, -1, -1, -1, 21, -1, -1, -1
+};
+
+// terminal symbols from 0 to 17
+const char * const TokenStream::s_operator_description_[c_operator_symbol_number_] =
+{
+	"$",
+	"$$",
+	"=",
+	"+",
+	"-",
+	"*",
+	"/",
+	"%",
+	"(",
+	")",
+	">",
+	"<",
+	"==",
+	"!",
+	";",
+	",",
+	"{",
+	"}"
+};
+
+char TokenStream::s_operator_table_[256];
+char TokenStream::s_double_operator_table_[256];
+bool TokenStream::s_built_ = TokenStream::s_BuildOperatorTable();
+
+bool TokenStream::s_BuildOperatorTable()
+{
+	// "-1" for others (like blanks)
+	for (int64_t i = 0; i < 256; ++i)
+	{
+		s_operator_table_[i] = -1;
+		s_double_operator_table_[i] = -1;
+	}
+	for (int64_t i = 0; i < c_operator_symbol_number_; ++i)
+	{
+		if (1 == strlen(s_operator_description_[i]))
+		{
+			s_operator_table_[(unsigned char)s_operator_description_[i][0]] = i;
+		}
+		else
+		{
+			s_double_operator_table_[(unsigned char)s_operator_description_[i][0]] = i;
+		}
+	}
+	return true;
+}
+
+int64_t TokenStream::s_SearchKeyword(const char * text, int64_t length)
+{
+	// Return the slot of the keyword, or -1.
+	if (NULL == text || length <= 0)
+	{
+		throw std::exception("Function \"int64_t TokenStream::s_SearchKeyword(const char * text, int64_t length)\" says: Invalid parameter \"text\".");
+	}
+	int64_t slot = ((unsigned char)text[0] + length) % c_keyword_slot_number_;
+	if (length == s_keyword_length_table_[slot] && 0 == memcmp(s_keyword_table_[slot], text, length))
+	{
+		return slot;
+	}
+	return -1;
+}
+
+int64_t TokenStream::s_GetSymbol(int64_t * type_p, const char * text, int64_t length)
+{
+	// Classify a word once: Return its terminal symbol of function "ParseBlock" (or -1), and turn an identifier into a keyword if it is.
+	if (NULL == type_p)
+	{
+		throw std::exception("Function \"int64_t TokenStream::s_GetSymbol(int64_t * type_p, const char * text, int64_t length)\" says: Invalid parameter \"type_p\".");
+	}
+	if (NULL == text || length <= 0)
+	{
+		throw std::exception("Function \"int64_t TokenStream::s_GetSymbol(int64_t * type_p, const char * text, int64_t length)\" says: Invalid parameter \"text\".");
+	}
+	int64_t slot;
+	switch (*type_p)
+	{
+	case c_keyword_:
+	case c_identifier_:
+		slot = s_SearchKeyword(text, length);
+		if (-1 == slot)
+		{
+			*type_p = c_identifier_;
+			return 26;
+		}
+		*type_p = c_keyword_;
+		return s_keyword_symbol_table_[slot];
+	case c_constant_int_:
+		return 25;
+	default:
+		// "$$" and "==" are the only operators of 2 chars.
+		return length > 1 ? s_double_operator_table_[(unsigned char)text[0]] : s_operator_table_[(unsigned char)text[0]];
+	}
+}
+
+TokenStream::TokenStream()
+{
+	size_ = 0;
+	text_ = NULL;
+}
+
+void TokenStream::SetText(const char * text)
+{
+	if (NULL == text)
+	{
+		throw std::exception("Function \"void TokenStream::SetText(const char * text)\" says: Invalid parameter \"text\".");
+	}
+	text_ = text;
+}
+
+void TokenStream::Append(int64_t type, int64_t location, int64_t text_index, int64_t length)
+{
+	if (NULL == text_)
+	{
+		throw std::exception("Function \"void TokenStream::Append(int64_t type, int64_t location, int64_t text_index, int64_t length)\" says: You should call function \"void TokenStream::SetText(const char * text)\" first.");
+	}
+	int64_t symbol = s_GetSymbol(&type, text_ + text_index, length);
+	type_table_.push_back(type);
+	symbol_table_.push_back(symbol);
+	location_table_.push_back(location);
+	text_table_.push_back(text_index);
+	length_table_.push_back(length);
+	id_table_.push_back(c_identifier_ == type ? Interner::s_interner_.Intern(text_ + text_index, length) : -1);
+	size_ += 1;
+}
+
+void TokenStream::RemoveBlank(bool is_block)
+{
+	// Remove blank tokens, and "{" in the beginning and "}" in the end of a block, in one pass.
+	int64_t size = 0;
+	for (int64_t i = 0; i < size_; ++i)
+	{
+		if (is_block && (0 == i || size_ - 1 == i))
+		{
+			continue;
+		}
+		if (c_separator_ == type_table_[i])
+		{
+			switch (text_[text_table_[i]])
+			{
+			case ' ':
+			case '\t':
+			case '\r':
+			case '\n':
+				continue;
+			default:
+				break;
+			}
+		}
+		type_table_[size] = type_table_[i];
+		symbol_table_[size] = symbol_table_[i];
+		location_table_[size] = location_table_[i];
+		text_table_[size] = text_table_[i];
+		length_table_[size] = length_table_[i];
+		id_table_[size] = id_table_[i];
+		size += 1;
+	}
+	size_ = size;
+	type_table_.resize(size_);
+	symbol_table_.resize(size_);
+	location_table_.resize(size_);
+	text_table_.resize(size_);
+	length_table_.resize(size_);
+	id_table_.resize(size_);
+}
+
+void TokenStream::Resize(int64_t size)
+{
+	if (size < 0)
+	{
+		throw std::exception("Function \"void TokenStream::Resize(int64_t size)\" says: Invalid parameter \"size\".");
+	}
+	size_ = size;
+	type_table_.resize(size_);
+	symbol_table_.resize(size_);
+	location_table_.resize(size_);
+	text_table_.resize(size_);
+	length_table_.resize(size_);
+	id_table_.resize(size_);
+}
+
+void TokenStream::Assign(int64_t index, const TokenStream * token_stream_p)
+{
+	// Copy the words of a piece (a view of the same text) to their place beginning at "index".
+	if (NULL == token_stream_p)
+	{
+		throw std::exception("Function \"void TokenStream::Assign(int64_t index, const TokenStream * token_stream_p)\" says: Invalid parameter \"token_stream_p\".");
+	}
+	if (index < 0 || index + token_stream_p->size_ > size_)
+	{
+		throw std::exception("Function \"void TokenStream::Assign(int64_t index, const TokenStream * token_stream_p)\" says: Invalid parameter \"index\".");
+	}
+	std::copy(token_stream_p->type_table_.begin(), token_stream_p->type_table_.end(), type_table_.begin() + index);
+	std::copy(token_stream_p->symbol_table_.begin(), token_stream_p->symbol_table_.end(), symbol_table_.begin() + index);
+	std::copy(token_stream_p->location_table_.begin(), token_stream_p->location_table_.end(), location_table_.begin() + index);
+	std::copy(token_stream_p->text_table_.begin(), token_stream_p->text_table_.end(), text_table_.begin() + index);
+	std::copy(token_stream_p->length_table_.begin(), token_stream_p->length_table_.end(), length_table_.begin() + index);
+	std::copy(token_stream_p->id_table_.begin(), token_stream_p->id_table_.end(), id_table_.begin() + index);
+}
+
+const char * TokenStream::GetText(int64_t index)
+{
+	// The text is not terminated by '\0'. Its length is "length_table_[index]".
+	if (index < 0 || index >= size_)
+	{
+		throw std::exception("Function \"const char * TokenStream::GetText(int64_t index)\" says: Invalid parameter \"index\".");
+	}
+	return text_ + text_table_[index];
+}
+
+char * TokenStream::CopyText(int64_t index, char * buffer)
+{
+	// Copy the text terminated by '\0' into "buffer" (whose size is "c_text_size_"), and return "buffer".
+	if (index < 0 || index >= size_)
+	{
+		throw std::exception("Function \"char * TokenStream::CopyText(int64_t index, char * buffer)\" says: Invalid parameter \"index\".");
+	}
+	if (NULL == buffer)
+	{
+		throw std::exception("Function \"char * TokenStream::CopyText(int64_t index, char * buffer)\" says: Invalid parameter \"buffer\".");
+	}
+	int64_t length = length_table_[index] < c_text_size_ - 1 ? length_table_[index] : c_text_size_ - 1;
+	memcpy(buffer, text_ + text_table_[index], length);
+	buffer[length] = '\0';
+	return buffer;
+}
+
+#endif
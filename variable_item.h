@@ -1,104 +1,121 @@
 #ifndef VARIABLE_ITEM_H_
 #define VARIABLE_ITEM_H_
 
+#pragma warning(disable:4996)
+
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdio.h>
+#include <new>
+#include <vector>
+#include <exception>
+#include "arena.h"
+#include "interner.h"
+#include "code_item.h"
 
 class VariableItem
 {
 public:
 	const static int64_t c_void_ = 0; // use for functions which returns "void" and blocks
 	const static int64_t c_int_ = 1;
-	static VariableItem * s_Malloc();
-	static void s_Free(VariableItem * variable_item);
-	static char s_buffer_[1024];
+	static VariableItem * s_Malloc(Arena * arena_p);
 	VariableItem();
-	~VariableItem();
-	int64_t SetName(const char * name);
-	int64_t SetGlobalName(const char * global_name);
-	// information
+	int64_t SetName(const char * name, Arena * arena_p);
+	const char * GetGlobalName(std::vector<char> * buffer_p, int64_t * length_p);
+	// information: The name is in the same arena as the item.
 	char * name_;
-	char * global_name_;
+	int32_t name_id_; // id of the name in "Interner::s_interner_"
+	// owner: the block where the variable is defined (-1 for a parameter), or the name id of the function of a parameter (-1 for a variable)
+	int64_t block_;
+	int32_t function_id_;
 	int64_t type_;
 	int64_t stack_offset;
 };
 
-VariableItem * VariableItem::s_Malloc()
+VariableItem * VariableItem::s_Malloc(Arena * arena_p)
 {
-	return new VariableItem();
-}
-
-void VariableItem::s_Free(VariableItem * variable_item)
-{
-	if (variable_item != NULL)
+	// The item is freed with the arena. No destructor is needed.
+	if (NULL == arena_p)
+	{
+		throw std::exception("Function \"VariableItem * VariableItem::s_Malloc(Arena * arena_p)\" says: Invalid parameter \"arena_p\".");
+	}
+	void * pointer = arena_p->Allocate(sizeof(VariableItem));
+	if (NULL == pointer)
 	{
-		delete variable_item;
+		return NULL;
 	}
+	return new (pointer) VariableItem();
 }
 
-char VariableItem::s_buffer_[1024] = { '\0' };
-
 VariableItem::VariableItem()
 {
 	name_ = NULL;
-	global_name_ = NULL;
+	name_id_ = -1;
+	block_ = -1;
+	function_id_ = -1;
 	type_ = -1;
 	stack_offset = -1;
 }
 
-VariableItem::~VariableItem()
-{
-	if (name_ != NULL)
-	{
-		delete[] name_;
-		name_ = NULL;
-	}
-	if (global_name_ != NULL)
-	{
-		delete[] global_name_;
-		global_name_ = NULL;
-	}
-}
-
-int64_t VariableItem::SetName(const char * name)
+int64_t VariableItem::SetName(const char * name, Arena * arena_p)
 {
 	if (NULL == name || "" == name)
 	{
-		throw std::exception("Function \"int64_t VariableItem::SetName(const char * name)\" says: Invalid parameter \"name\".");
+		throw std::exception("Function \"int64_t VariableItem::SetName(const char * name, Arena * arena_p)\" says: Invalid parameter \"name\".");
 	}
-	if (name_ != NULL)
+	if (NULL == arena_p)
 	{
-		delete[] name_;
-		name_ = NULL;
+		throw std::exception("Function \"int64_t VariableItem::SetName(const char * name, Arena * arena_p)\" says: Invalid parameter \"arena_p\".");
 	}
-	name_ = new char[strlen(name) + 1];
+	name_ = arena_p->CopyString(name);
 	if (NULL == name_)
 	{
 		return -1;
 	}
-	strcpy(name_, name);
 	return 1;
 }
 
-int64_t VariableItem::SetGlobalName(const char * global_name)
+const char * VariableItem::GetGlobalName(std::vector<char> * buffer_p, int64_t * length_p)
 {
-	if (NULL == global_name || "" == global_name)
+	// "block_[id]_[name]" for a variable, or "function_[function name]_[name]" for a parameter: The buffer grows to the length of the names, which is not limited.
+	if (NULL == buffer_p)
 	{
-		throw std::exception("Function \"int64_t SetGlobalName(const char * global_name)\" says: Invalid parameter \"global_name\".");
+		throw std::exception("Function \"const char * VariableItem::GetGlobalName(std::vector<char> * buffer_p, int64_t * length_p)\" says: Invalid parameter \"buffer_p\".");
 	}
-	if (global_name_ != NULL)
+	if (NULL == length_p)
 	{
-		delete[] global_name_;
-		global_name_ = NULL;
+		throw std::exception("Function \"const char * VariableItem::GetGlobalName(std::vector<char> * buffer_p, int64_t * length_p)\" says: Invalid parameter \"length_p\".");
 	}
-	global_name_ = new char[strlen(global_name) + 1];
-	if (NULL == global_name_)
+	// "function_" or "block_" with at most 20 digits, "_", and '\0'
+	int64_t name_length = Interner::s_interner_.GetLength(name_id_);
+	int64_t owner_length = -1 == block_ ? Interner::s_interner_.GetLength(function_id_) : 0;
+	if ((int64_t)buffer_p->size() < owner_length + name_length + 32)
 	{
-		return -1;
+		buffer_p->resize(owner_length + name_length + 32);
 	}
-	strcpy(global_name_, global_name);
-	return 1;
+	char * buffer = &((*buffer_p)[0]);
+	int64_t length;
+	// It is written for each use of the variable, so no format is parsed.
+	if (-1 == block_)
+	{
+		length = 9;
+		memcpy(buffer, "function_", 9);
+		memcpy(buffer + length, Interner::s_interner_.GetText(function_id_), owner_length);
+		length += owner_length;
+	}
+	else
+	{
+		length = 6;
+		memcpy(buffer, "block_", 6);
+		length += CodeItem::s_FormatInteger(block_, buffer + length);
+	}
+	buffer[length++] = '_';
+	memcpy(buffer + length, Interner::s_interner_.GetText(name_id_), name_length);
+	length += name_length;
+	buffer[length] = '\0';
+	*length_p = length;
+	return buffer;
 }
 
 #endif